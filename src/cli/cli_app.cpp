@@ -14,10 +14,14 @@
 
 #include "cli/cli_app.hpp"
 #include "core/watermark_engine.hpp"
+#include "core/batch_pipeline.hpp"
+#include "core/file_io.hpp"
+#include "core/image_codec.hpp"
 #include "utils/ascii_logo.hpp"
 #include "utils/path_formatter.hpp"
 #include "embedded_assets.hpp"
 
+#include <opencv2/imgcodecs.hpp>
 #include <CLI/CLI.hpp>
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
@@ -26,7 +30,10 @@
 
 #include <filesystem>
 #include <algorithm>
+#include <chrono>
+#include <span>
 #include <string>
+#include <vector>
 
 // TTY detection (cross-platform)
 #ifdef _WIN32
@@ -85,6 +92,7 @@ struct BatchResult {
     int success = 0;
     int skipped = 0;
     int failed = 0;
+    double elapsed_seconds = 0.0;   // Wall time (directory mode only)
 
     void print() const {
         int total = success + skipped + failed;
@@ -98,24 +106,27 @@ struct BatchResult {
             if (failed > 0) {
                 fmt::print(fmt::fg(fmt::color::red), ", Failed: {}", failed);
             }
-            fmt::print(" (Total: {})\n", total);
+            fmt::print(" (Total: {})", total);
+            if (elapsed_seconds > 0.0) {
+                fmt::print(fmt::fg(fmt::color::gray), " in {:.2f}s", elapsed_seconds);
+            }
+            fmt::print("\n");
         }
     }
 };
 
-void process_single(
-    const fs::path& input,
-    const fs::path& output,
-    bool remove,
-    WatermarkEngine& engine,
-    std::optional<WatermarkSize> force_size,
-    bool use_detection,
-    float detection_threshold,
-    BatchResult& result
-) {
-    auto proc_result = process_image(input, output, remove, engine,
-                                     force_size, use_detection, detection_threshold);
+/**
+ * Check if a path has a supported image extension
+ */
+bool is_supported_image(const fs::path& path) {
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+    return ext == ".jpg" || ext == ".jpeg" || ext == ".png" ||
+           ext == ".webp" || ext == ".bmp";
+}
 
+void report_result(const fs::path& input, const ProcessResult& proc_result, BatchResult& result) {
     if (proc_result.skipped) {
         result.skipped++;
         fmt::print(fmt::fg(fmt::color::yellow), "[SKIP] ");
@@ -136,6 +147,182 @@ void process_single(
     }
 }
 
+void process_single(
+    const fs::path& input,
+    std::span<const OutputSpec> outputs,
+    bool remove,
+    WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    bool use_detection,
+    float detection_threshold,
+    BatchResult& result
+) {
+    auto proc_result = process_image(input, outputs, remove, engine,
+                                     force_size, use_detection, detection_threshold);
+    report_result(input, proc_result, result);
+}
+
+// =============================================================================
+// Extra outputs (--emit)
+// =============================================================================
+
+struct EmitSpec {
+    std::string extension;                      // "jpg", "png", "webp", "bmp"
+    EncodeProfile profile = EncodeProfile::Max;
+    int max_dimension = 0;
+};
+
+/**
+ * Parse FORMAT[:PROFILE][:MAXDIM], e.g. "webp:fast:1024" or "jpg::256"
+ */
+std::optional<EmitSpec> parse_emit_spec(const std::string& text) {
+    std::vector<std::string> parts;
+    size_t start = 0;
+    while (true) {
+        const size_t colon = text.find(':', start);
+        parts.push_back(text.substr(start, colon - start));
+        if (colon == std::string::npos) break;
+        start = colon + 1;
+    }
+    if (parts.empty() || parts.size() > 3) return std::nullopt;
+
+    EmitSpec spec;
+    spec.extension = parts[0];
+    std::transform(spec.extension.begin(), spec.extension.end(),
+                   spec.extension.begin(), ::tolower);
+    if (!is_supported_image(fs::path("x." + spec.extension))) return std::nullopt;
+
+    if (parts.size() >= 2 && !parts[1].empty()) {
+        const auto profile = parse_encode_profile(parts[1]);
+        if (!profile) return std::nullopt;
+        spec.profile = *profile;
+    }
+
+    if (parts.size() == 3 && !parts[2].empty()) {
+        try {
+            spec.max_dimension = std::stoi(parts[2]);
+        } catch (const std::exception&) {
+            return std::nullopt;
+        }
+        if (spec.max_dimension <= 0) return std::nullopt;
+    }
+    return spec;
+}
+
+/**
+ * Output path for an emitted rendition: <stem>[_<maxdim>].<ext> next to the primary output
+ */
+fs::path emit_path(const fs::path& primary, const EmitSpec& spec) {
+    fs::path path = primary.parent_path() / primary.stem();
+    if (spec.max_dimension > 0) {
+        path += "_" + std::to_string(spec.max_dimension);
+    }
+    path += "." + spec.extension;
+    return path;
+}
+
+/**
+ * Extra outputs for one primary output (renditions that would overwrite it are dropped)
+ */
+std::vector<OutputSpec> make_extra_outputs(const fs::path& primary,
+                                           const std::vector<EmitSpec>& emits) {
+    std::vector<OutputSpec> outputs;
+    for (const auto& emit : emits) {
+        fs::path path = emit_path(primary, emit);
+        if (path == primary) {
+            spdlog::warn("--emit {}: same path as the primary output, ignored", emit.extension);
+            continue;
+        }
+        outputs.push_back(OutputSpec{std::move(path), emit.profile, emit.max_dimension});
+    }
+    return outputs;
+}
+
+/**
+ * Parse --io value into a backend type
+ */
+IoBackendType parse_io_backend(const std::string& name) {
+    if (name == "sync") return IoBackendType::Sync;
+    if (name == "uring") return IoBackendType::IoUring;
+    return IoBackendType::Auto;
+}
+
+/**
+ * Encode benchmark: time and size of every profile for JPEG/PNG/WebP output
+ * over the given file or directory. Images are decoded once up front so
+ * only encoding is measured.
+ */
+int run_encode_benchmark(const fs::path& input) {
+    std::vector<fs::path> files;
+    if (fs::is_directory(input)) {
+        for (const auto& entry : fs::directory_iterator(input)) {
+            if (entry.is_regular_file() && is_supported_image(entry.path())) {
+                files.push_back(entry.path());
+            }
+        }
+    } else {
+        files.push_back(input);
+    }
+
+    std::vector<cv::Mat> images;
+    std::vector<EncodeSource> sources;
+    size_t total_pixels = 0;
+    for (const auto& file : files) {
+        cv::Mat image = cv::imread(file.string(), cv::IMREAD_COLOR);
+        if (image.empty()) {
+            spdlog::warn("Skipping unreadable file: {}", file);
+            continue;
+        }
+        total_pixels += image.total();
+        images.push_back(std::move(image));
+        sources.push_back(probe_encode_source(file));
+    }
+
+    if (images.empty()) {
+        fmt::print(fmt::fg(fmt::color::red), "[ERROR] ");
+        fmt::print("No images to benchmark\n");
+        return 1;
+    }
+
+    fmt::print("Encode benchmark: {} image(s), {:.1f} MPixel total\n\n",
+               images.size(), static_cast<double>(total_pixels) / 1e6);
+    fmt::print("{:<6} {:<12} {:>10} {:>12} {:>8} {:>8}\n",
+               "Format", "Profile", "Time (ms)", "Size (KiB)", "Time %", "Size %");
+    fmt::print("{}\n", std::string(61, '-'));
+
+    std::vector<uint8_t> buffer;
+    for (const char* ext : {".jpg", ".png", ".webp"}) {
+        const fs::path target = fs::path("bench").replace_extension(ext);
+        double base_ms = 0.0;
+        size_t base_bytes = 0;
+
+        for (EncodeProfile profile : kAllEncodeProfiles) {
+            size_t bytes = 0;
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < images.size(); ++i) {
+                if (encode_image(images[i], target, buffer, profile, sources[i])) {
+                    bytes += buffer.size();
+                }
+            }
+            const double ms = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start).count();
+
+            if (profile == EncodeProfile::Max) {
+                base_ms = ms;
+                base_bytes = bytes;
+            }
+
+            fmt::print("{:<6} {:<12} {:>10.1f} {:>12.1f} {:>7.0f}% {:>7.0f}%\n",
+                       ext + 1, to_string(profile), ms,
+                       static_cast<double>(bytes) / 1024.0,
+                       base_ms > 0.0 ? ms / base_ms * 100.0 : 0.0,
+                       base_bytes > 0 ? static_cast<double>(bytes) / base_bytes * 100.0 : 0.0);
+        }
+    }
+
+    return 0;
+}
+
 /**
  * Parse --banner / --no-banner from argv before CLI11 parsing.
  * Returns: std::nullopt (use auto), true (force show), false (force hide)
@@ -236,8 +423,9 @@ int run_simple_mode(int argc, char** argv) {
                 continue;
             }
 
-            process_single(input, input, true, engine, std::nullopt,
-                          use_detection, detection_threshold, result);
+            const OutputSpec output{input, EncodeProfile::Max, 0};
+            process_single(input, std::span<const OutputSpec>(&output, 1), true, engine,
+                          std::nullopt, use_detection, detection_threshold, result);
         }
 
         result.print();
@@ -278,8 +466,8 @@ int run(int argc, char** argv) {
         ->required();
         // Note: We check existence manually below for better CJK path error messages
 
-    app.add_option("-o,--output", output_path, "Output image file or directory")
-        ->required();
+    app.add_option("-o,--output", output_path, "Output image file or directory");
+        // Required unless --bench-encode is given (checked below)
 
     // Operation mode
     bool remove_mode = false;
@@ -302,6 +490,39 @@ int run(int argc, char** argv) {
     app.add_flag("--force-small", force_small, "Force use of 48x48 watermark regardless of image size");
     app.add_flag("--force-large", force_large, "Force use of 96x96 watermark regardless of image size");
 
+    // Skipped files (directory mode)
+    bool copy_skipped = false;
+    bool link_skipped = false;
+    app.add_flag("--copy-skipped", copy_skipped,
+                 "Copy skipped (no watermark) inputs to the output directory unchanged, "
+                 "using reflink/copy_file_range where available");
+    app.add_flag("--link-skipped", link_skipped,
+                 "Like --copy-skipped, but hardlink when input and output share a filesystem. "
+                 "The output then IS the original file: this tool replaces it instead of "
+                 "writing through, but other programs that edit it in place modify the input");
+
+    // Encode profile
+    std::string profile_name{to_string(EncodeProfile::Max)};
+    app.add_option("--profile", profile_name,
+                   "Output encode profile: max, fast, balanced, smallest, match-input (default: max)")
+        ->check(CLI::IsMember({"max", "fast", "balanced", "smallest", "match-input"}));
+
+    std::vector<std::string> emit_texts;
+    app.add_option("--emit", emit_texts,
+                   "Extra output from the same decoded frame: FORMAT[:PROFILE][:MAXDIM] "
+                   "(e.g. webp:fast:1024). Written next to the output as <name>[_MAXDIM].FORMAT; repeatable");
+
+    bool bench_encode = false;
+    app.add_flag("--bench-encode", bench_encode,
+                 "Benchmark encode time and size of every profile on the input, then exit");
+
+    // Batch I/O backend (directory mode)
+    std::string io_backend = "auto";
+    app.add_option("--io", io_backend,
+                   "File I/O backend for directory mode: auto, sync, uring "
+                   "(default: auto, which currently means sync)")
+        ->check(CLI::IsMember({"auto", "sync", "uring"}));
+
     // Verbosity
     bool verbose = false;
     bool quiet = false;
@@ -311,6 +532,12 @@ int run(int argc, char** argv) {
     // Parse arguments
     CLI11_PARSE(app, argc, argv);
 
+    if (output_path.empty() && !bench_encode) {
+        fmt::print(fmt::fg(fmt::color::red), "[ERROR] ");
+        fmt::print("--output is required\n");
+        return 1;
+    }
+
     // Print banner after parsing (so --help doesn't show banner)
     if (should_show_banner(banner_flag)) {
         print_banner();
@@ -347,8 +574,22 @@ int run(int argc, char** argv) {
         spdlog::info("Forcing 96x96 watermark size");
     }
 
+    const EncodeProfile profile = parse_encode_profile(profile_name).value_or(EncodeProfile::Max);
+
+    std::vector<EmitSpec> emits;
+    for (const auto& text : emit_texts) {
+        auto spec = parse_emit_spec(text);
+        if (!spec) {
+            spdlog::error("Invalid --emit value '{}' (expected FORMAT[:PROFILE][:MAXDIM])", text);
+            return 1;
+        }
+        emits.push_back(*spec);
+    }
+
     // Print detection status
-    if (use_detection) {
+    if (bench_encode) {
+        // Benchmark mode does not process watermarks
+    } else if (use_detection) {
         fmt::print(fmt::fg(fmt::color::gray),
                    "Auto-detection enabled (threshold: {:.0f}%)\n\n",
                    detection_threshold * 100.0f);
@@ -377,6 +618,10 @@ int run(int argc, char** argv) {
             return 1;
         }
 
+        if (bench_encode) {
+            return run_encode_benchmark(input);
+        }
+
         BatchResult result;
 
         if (fs::is_directory(input)) {
@@ -384,27 +629,42 @@ int run(int argc, char** argv) {
                 fs::create_directories(output);
             }
 
-            spdlog::info("Batch processing directory: {}", input);
+            auto io = create_file_io(parse_io_backend(io_backend));
+            spdlog::info("Batch processing directory: {} (I/O: {})", input, io->name());
 
+            std::vector<BatchItem> items;
             for (const auto& entry : fs::directory_iterator(input)) {
-                if (!entry.is_regular_file()) continue;
-
-                std::string ext = entry.path().extension().string();
-                std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-
-                if (ext != ".jpg" && ext != ".jpeg" && ext != ".png" &&
-                    ext != ".webp" && ext != ".bmp") {
-                    continue;
-                }
+                if (!entry.is_regular_file() || !is_supported_image(entry.path())) continue;
 
                 fs::path out_file = output / entry.path().filename();
-                process_single(entry.path(), out_file, remove_mode, engine,
-                              force_size, use_detection, detection_threshold, result);
+                auto extra = make_extra_outputs(out_file, emits);
+                items.push_back(BatchItem{entry.path(), std::move(out_file), std::move(extra)});
             }
 
+            BatchOptions options;
+            options.remove = remove_mode;
+            options.force_size = force_size;
+            options.use_detection = use_detection;
+            options.detection_threshold = detection_threshold;
+            options.copy_skipped = copy_skipped;
+            options.link_skipped = link_skipped;
+            options.profile = profile;
+
+            const auto start = std::chrono::steady_clock::now();
+            process_batch(items, *io, engine, options,
+                          [&](const BatchItem& item, const ProcessResult& proc_result) {
+                              report_result(item.input, proc_result, result);
+                          });
+            result.elapsed_seconds = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count();
+
             result.print();
         } else {
-            process_single(input, output, remove_mode, engine,
+            std::vector<OutputSpec> outputs{OutputSpec{output, profile, 0}};
+            auto extra = make_extra_outputs(output, emits);
+            outputs.insert(outputs.end(), extra.begin(), extra.end());
+
+            process_single(input, outputs, remove_mode, engine,
                           force_size, use_detection, detection_threshold, result);
         }
 
@@ -0,0 +1,220 @@
+/**
+ * @file    batch_pipeline.cpp
+ * @brief   Windowed Batch Processing Pipeline Implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#include "core/batch_pipeline.hpp"
+#include "utils/path_formatter.hpp"
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <spdlog/spdlog.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace gwt {
+
+namespace {
+
+struct WindowSlot {
+    cv::Mat image;
+    EncodeSource source;                // Filled for EncodeProfile::MatchInput
+    ProcessResult result{};
+    std::vector<std::vector<uint8_t>> encoded;  // Primary output, then extra_outputs
+    bool needs_write = false;
+};
+
+}  // anonymous namespace
+
+void process_batch(
+    std::span<const BatchItem> items,
+    IFileIO& io,
+    WatermarkEngine& engine,
+    const BatchOptions& options,
+    const BatchItemCallback& on_item)
+{
+    const size_t max_window = std::max<size_t>(1, options.window_size);
+    const size_t byte_budget = options.window_bytes ? options.window_bytes : SIZE_MAX;
+    size_t window = max_window;
+
+    std::vector<std::filesystem::path> inputs;
+    std::vector<WindowSlot> slots;
+    std::vector<FileWriteRequest> writes;
+    std::vector<size_t> write_index;
+
+    for (size_t base = 0; base < items.size(); ) {
+        const size_t read_count = std::min(window, items.size() - base);
+
+        inputs.clear();
+        for (const auto& item : items.subspan(base, read_count)) {
+            inputs.push_back(item.input);
+        }
+        slots.assign(read_count, WindowSlot{});
+
+        // The window is cut at the first input that arrives once the decoded
+        // frames reach the byte budget; the first input always decodes so
+        // every window makes progress.
+        size_t count = read_count;
+        size_t decoded_bytes = 0;
+
+        // ---------------------------------------------------------------------
+        // Stage 1: Read + decode (decode overlaps with the remaining reads)
+        // ---------------------------------------------------------------------
+        io.read_files(inputs, [&](size_t i, std::span<const uint8_t> data, bool ok) {
+            if (i >= count) return;
+            if (i > 0 && decoded_bytes >= byte_budget) {
+                count = i;
+                return;
+            }
+
+            WindowSlot& slot = slots[i];
+            if (!ok || data.empty()) {
+                slot.result.message = "Failed to load image";
+                return;
+            }
+
+            // A corrupt or oversized input fails only its own item
+            try {
+                if (options.profile == EncodeProfile::MatchInput) {
+                    slot.source = probe_encode_source(data);
+                }
+
+                // Wrap the I/O buffer without copying; imdecode does not retain it
+                const cv::Mat raw(1, static_cast<int>(data.size()), CV_8UC1,
+                                  const_cast<uint8_t*>(data.data()));
+                slot.image = cv::imdecode(raw, cv::IMREAD_COLOR);
+            } catch (const std::exception& e) {
+                slot.image.release();
+                slot.result.message = std::string("Error: ") + e.what();
+                spdlog::error("Error decoding {}: {}", inputs[i], e.what());
+                return;
+            }
+
+            if (slot.image.empty()) {
+                slot.result.message = "Failed to decode image";
+                spdlog::error("Failed to decode image: {}", inputs[i]);
+            }
+            decoded_bytes += slot.image.total() * slot.image.elemSize();
+        });
+
+        // Completions may arrive out of order: drop frames past the cut
+        for (size_t i = count; i < read_count; ++i) {
+            slots[i].image.release();
+        }
+        slots.resize(count);
+
+        const auto batch = items.subspan(base, count);
+        base += count;
+        window = (count < read_count) ? count + 1 : std::min(max_window, window * 2);
+
+        // ---------------------------------------------------------------------
+        // Stage 2: Detect / process / encode in parallel
+        // ---------------------------------------------------------------------
+        cv::parallel_for_(cv::Range(0, static_cast<int>(count)), [&](const cv::Range& range) {
+            for (int r = range.start; r < range.end; ++r) {
+                WindowSlot& slot = slots[static_cast<size_t>(r)];
+                const BatchItem& item = batch[static_cast<size_t>(r)];
+                if (slot.image.empty()) continue;
+
+                try {
+                    slot.result = process_loaded_image(
+                        slot.image, item.input, options.remove, engine,
+                        options.force_size, options.use_detection,
+                        options.detection_threshold);
+
+                    if (slot.result.success && !slot.result.skipped) {
+                        slot.encoded.resize(1 + item.extra_outputs.size());
+                        bool encoded = encode_image(slot.image, item.output, slot.encoded[0],
+                                                    options.profile, slot.source);
+
+                        for (size_t k = 0; encoded && k < item.extra_outputs.size(); ++k) {
+                            const OutputSpec& spec = item.extra_outputs[k];
+                            encoded = encode_image(
+                                fit_to_max_dimension(slot.image, spec.max_dimension),
+                                spec.path, slot.encoded[k + 1], spec.profile, slot.source);
+                        }
+
+                        if (encoded) {
+                            slot.needs_write = true;
+                        } else {
+                            slot.result.success = false;
+                            slot.result.message = "Failed to encode image";
+                        }
+                    }
+                } catch (const std::exception& e) {
+                    slot.result.success = false;
+                    slot.result.message = std::string("Error: ") + e.what();
+                    spdlog::error("Error processing {}: {}", item.input, e.what());
+                }
+
+                slot.image.release();
+            }
+        });
+
+        // ---------------------------------------------------------------------
+        // Stage 3: Batched write
+        // ---------------------------------------------------------------------
+        writes.clear();
+        write_index.clear();
+        for (size_t i = 0; i < count; ++i) {
+            if (!slots[i].needs_write) continue;
+
+            for (size_t k = 0; k < slots[i].encoded.size(); ++k) {
+                const auto& path = (k == 0) ? batch[i].output
+                                            : batch[i].extra_outputs[k - 1].path;
+
+                const auto output_dir = path.parent_path();
+                std::error_code ec;
+                if (!output_dir.empty() && !std::filesystem::exists(output_dir, ec)) {
+                    std::filesystem::create_directories(output_dir, ec);
+                }
+
+                writes.push_back(FileWriteRequest{path, slots[i].encoded[k]});
+                write_index.push_back(i);
+            }
+        }
+
+        const auto written = io.write_files(writes);
+        for (size_t w = 0; w < written.size(); ++w) {
+            WindowSlot& slot = slots[write_index[w]];
+            if (written[w]) {
+                spdlog::info("Saved: {}", writes[w].path.filename());
+            } else {
+                slot.result.success = false;
+                slot.result.message = "Failed to write image";
+            }
+        }
+
+        // Skipped inputs: materialize the original bytes at the output path
+        if (options.copy_skipped || options.link_skipped) {
+            for (size_t i = 0; i < count; ++i) {
+                ProcessResult& result = slots[i].result;
+                if (!result.skipped) continue;
+
+                const CopyMethod method = copy_through(batch[i].input, batch[i].output,
+                                                       options.link_skipped);
+                if (method == CopyMethod::None) {
+                    result.success = false;
+                    result.skipped = false;
+                    result.message = "Skipped, but failed to copy original";
+                } else if (method != CopyMethod::InPlace) {
+                    result.message += fmt::format(", copied ({})", to_string(method));
+                }
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            if (on_item) {
+                on_item(batch[i], slots[i].result);
+            }
+        }
+    }
+}
+
+}  // namespace gwt
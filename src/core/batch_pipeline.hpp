@@ -0,0 +1,78 @@
+/**
+ * @file    batch_pipeline.hpp
+ * @brief   Windowed Batch Processing Pipeline
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Processes a list of files in windows bounded by file count and by
+ * decoded bytes:
+ *   1. read all inputs of the window through an IFileIO backend
+ *      (decoding each as soon as its read completes)
+ *   2. detect / remove / encode the window in parallel
+ *   3. write all outputs of the window as one batch
+ *      (skipped inputs are optionally copied through without re-encoding)
+ *
+ * With the io_uring backend, steps 1 and 3 are a handful of syscalls per
+ * window instead of open/read/close per file.
+ *
+ * A window stops decoding once its frames reach BatchOptions::window_bytes;
+ * the remaining files of that read are deferred to the next window, whose
+ * size is then shrunk to what fitted so deferred files are rarely re-read.
+ */
+
+#pragma once
+
+#include "core/file_io.hpp"
+#include "core/image_codec.hpp"
+#include "core/watermark_engine.hpp"
+
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace gwt {
+
+struct BatchItem {
+    std::filesystem::path input;
+    std::filesystem::path output;               // Encoded with BatchOptions::profile
+    std::vector<OutputSpec> extra_outputs;      // Additional renditions of the same frame
+};
+
+struct BatchOptions {
+    bool remove = true;
+    std::optional<WatermarkSize> force_size;
+    bool use_detection = true;
+    float detection_threshold = 0.25f;
+    bool copy_skipped = false;          // Copy skipped inputs to their output path
+    bool link_skipped = false;          // Prefer hardlinks for copy_skipped
+    EncodeProfile profile = EncodeProfile::Max;
+    size_t window_size = 32;            // Files per read/process/write window
+    size_t window_bytes = size_t{1} << 30;  // Decoded frame bytes per window (0 = unbounded)
+};
+
+/**
+ * Per-item completion callback, invoked in input order
+ */
+using BatchItemCallback = std::function<void(const BatchItem& item, const ProcessResult& result)>;
+
+/**
+ * Process a list of files through the windowed pipeline
+ *
+ * @param items     Input/output pairs
+ * @param io        File I/O backend used for reads and writes
+ * @param engine    The watermark engine to use
+ * @param options   Processing options
+ * @param on_item   Called for each item once its window is written
+ */
+void process_batch(
+    std::span<const BatchItem> items,
+    IFileIO& io,
+    WatermarkEngine& engine,
+    const BatchOptions& options,
+    const BatchItemCallback& on_item
+);
+
+}  // namespace gwt
@@ -0,0 +1,238 @@
+/**
+ * @file    file_io.cpp
+ * @brief   Batched File I/O Backends - Sync Backend and Factory
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#include "core/file_io.hpp"
+#include "utils/path_formatter.hpp"
+
+#if defined(GWT_HAS_IO_URING)
+#include "core/uring_file_io.hpp"
+#endif
+
+#include <spdlog/spdlog.h>
+
+#include <fstream>
+#include <system_error>
+
+#if defined(__linux__) && !defined(__ANDROID__)
+    #include <fcntl.h>
+    #include <linux/fs.h>
+    #include <sys/ioctl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #include <cerrno>
+    #define GWT_HAS_KERNEL_COPY 1
+#elif defined(__APPLE__)
+    #include <sys/clonefile.h>
+    #include <cerrno>
+#endif
+
+namespace gwt {
+
+// =============================================================================
+// SyncFileIO
+// =============================================================================
+
+void SyncFileIO::read_files(std::span<const std::filesystem::path> paths,
+                            const ReadCallback& callback) {
+    for (size_t i = 0; i < paths.size(); ++i) {
+        std::ifstream file(paths[i], std::ios::binary | std::ios::ate);
+        if (!file) {
+            spdlog::error("Failed to open: {}", paths[i]);
+            callback(i, {}, false);
+            continue;
+        }
+
+        const auto size = static_cast<size_t>(file.tellg());
+        file.seekg(0, std::ios::beg);
+
+        buffer_.resize(size);
+        if (size > 0 && !file.read(reinterpret_cast<char*>(buffer_.data()),
+                                   static_cast<std::streamsize>(size))) {
+            spdlog::error("Failed to read: {}", paths[i]);
+            callback(i, {}, false);
+            continue;
+        }
+
+        callback(i, std::span<const uint8_t>(buffer_.data(), size), true);
+    }
+}
+
+std::vector<bool> SyncFileIO::write_files(std::span<const FileWriteRequest> requests) {
+    std::vector<bool> results(requests.size(), false);
+
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const auto& req = requests[i];
+        detach_hardlink(req.path);
+        std::ofstream file(req.path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            spdlog::error("Failed to open for writing: {}", req.path);
+            continue;
+        }
+
+        file.write(reinterpret_cast<const char*>(req.data.data()),
+                   static_cast<std::streamsize>(req.data.size()));
+        results[i] = static_cast<bool>(file);
+        if (!results[i]) {
+            spdlog::error("Failed to write: {}", req.path);
+        }
+    }
+
+    return results;
+}
+
+// =============================================================================
+// Copy-Through
+// =============================================================================
+
+namespace {
+
+#if defined(GWT_HAS_KERNEL_COPY)
+/**
+ * Clone or in-kernel copy; returns CopyMethod::None if neither is possible
+ * (e.g. cross-filesystem on an old kernel), leaving dst to the caller.
+ */
+CopyMethod kernel_copy(const std::filesystem::path& src, const std::filesystem::path& dst) {
+    const int in = ::open(src.c_str(), O_RDONLY | O_CLOEXEC);
+    if (in < 0) return CopyMethod::None;
+
+    struct stat st{};
+    if (::fstat(in, &st) != 0) {
+        ::close(in);
+        return CopyMethod::None;
+    }
+
+    const int out = ::open(dst.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                           st.st_mode & 0777);
+    if (out < 0) {
+        ::close(in);
+        return CopyMethod::None;
+    }
+
+    CopyMethod method = CopyMethod::None;
+
+    if (::ioctl(out, FICLONE, in) == 0) {
+        method = CopyMethod::Reflink;
+    } else {
+        auto remaining = static_cast<size_t>(st.st_size);
+        bool ok = true;
+        while (remaining > 0) {
+            const ssize_t n = ::copy_file_range(in, nullptr, out, nullptr, remaining, 0);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) {
+                ok = false;
+                break;
+            }
+            remaining -= static_cast<size_t>(n);
+        }
+        if (ok) method = CopyMethod::CopyRange;
+    }
+
+    ::close(out);
+    ::close(in);
+    return method;
+}
+#endif
+
+}  // anonymous namespace
+
+CopyMethod copy_through(const std::filesystem::path& src,
+                        const std::filesystem::path& dst,
+                        bool allow_hardlink) {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+
+    // In-place output: the file is already where it needs to be
+    if (fs::exists(dst, ec) && fs::equivalent(src, dst, ec)) {
+        return CopyMethod::InPlace;
+    }
+
+    const auto dst_dir = dst.parent_path();
+    if (!dst_dir.empty() && !fs::exists(dst_dir, ec)) {
+        fs::create_directories(dst_dir, ec);
+    }
+    detach_hardlink(dst);
+
+    if (allow_hardlink) {
+        fs::remove(dst, ec);
+        fs::create_hard_link(src, dst, ec);
+        if (!ec) return CopyMethod::Hardlink;
+        spdlog::debug("Hardlink failed ({}), copying: {}", ec.message(), dst);
+    }
+
+#if defined(GWT_HAS_KERNEL_COPY)
+    if (const CopyMethod method = kernel_copy(src, dst); method != CopyMethod::None) {
+        return method;
+    }
+#elif defined(__APPLE__)
+    fs::remove(dst, ec);
+    if (::clonefile(src.c_str(), dst.c_str(), 0) == 0) {
+        return CopyMethod::Reflink;
+    }
+#endif
+
+    ec.clear();
+    fs::copy_file(src, dst, fs::copy_options::overwrite_existing, ec);
+    if (ec) {
+        spdlog::error("Failed to copy {} -> {}: {}", src, dst, ec.message());
+        return CopyMethod::None;
+    }
+    return CopyMethod::Copy;
+}
+
+void detach_hardlink(const std::filesystem::path& path) {
+    std::error_code ec;
+    if (std::filesystem::hard_link_count(path, ec) > 1 && !ec) {
+        if (!std::filesystem::remove(path, ec) && ec) {
+            spdlog::warn("Failed to unlink shared output {}: {}", path, ec.message());
+        }
+    }
+}
+
+// =============================================================================
+// Factory
+// =============================================================================
+
+std::unique_ptr<IFileIO> create_file_io(IoBackendType type) {
+    // Auto stays on the sync backend: io_uring has not been benchmarked
+    // against it yet, so it is only used when requested explicitly
+#if defined(GWT_HAS_IO_URING)
+    if (type == IoBackendType::IoUring) {
+        auto uring = std::make_unique<UringFileIO>();
+        if (uring->init()) {
+            spdlog::debug("Using io_uring file I/O backend");
+            return uring;
+        }
+        spdlog::warn("io_uring unavailable, falling back to sync I/O");
+    }
+#else
+    if (type == IoBackendType::IoUring) {
+        spdlog::warn("io_uring support not compiled in, falling back to sync I/O");
+    }
+#endif
+
+    return std::make_unique<SyncFileIO>();
+}
+
+bool is_io_backend_available(IoBackendType type) {
+    switch (type) {
+        case IoBackendType::Sync:
+        case IoBackendType::Auto:
+            return true;
+
+        case IoBackendType::IoUring:
+#if defined(GWT_HAS_IO_URING)
+            return UringFileIO::is_supported();
+#else
+            return false;
+#endif
+
+        default:
+            return false;
+    }
+}
+
+}  // namespace gwt
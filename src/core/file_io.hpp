@@ -0,0 +1,194 @@
+/**
+ * @file    file_io.hpp
+ * @brief   Batched File I/O Backends
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Abstracts whole-file reads and writes for the batch pipeline so that
+ * many small files can be submitted together. The synchronous backend
+ * uses plain stream I/O and is always available; on Linux an io_uring
+ * backend (GWT_HAS_IO_URING) submits a window of reads/writes at once.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace gwt {
+
+// =============================================================================
+// Backend Types
+// =============================================================================
+
+enum class IoBackendType {
+    Sync,       // Blocking stream I/O (portable)
+    IoUring,    // Linux io_uring (batched submission)
+    Auto        // Default choice (currently Sync; see create_file_io)
+};
+
+[[nodiscard]] constexpr std::string_view to_string(IoBackendType type) noexcept {
+    switch (type) {
+        case IoBackendType::Sync:    return "sync";
+        case IoBackendType::IoUring: return "io_uring";
+        case IoBackendType::Auto:    return "auto";
+        default:                     return "unknown";
+    }
+}
+
+// =============================================================================
+// Requests
+// =============================================================================
+
+struct FileWriteRequest {
+    std::filesystem::path path;
+    std::span<const uint8_t> data;
+};
+
+/**
+ * Read completion callback
+ *
+ * Invoked once per requested file, in completion order (not request order).
+ * The data span is only valid for the duration of the call.
+ *
+ * @param index  Index into the requested path list
+ * @param data   File contents (empty on failure)
+ * @param ok     Whether the read succeeded
+ */
+using ReadCallback = std::function<void(size_t index, std::span<const uint8_t> data, bool ok)>;
+
+// =============================================================================
+// File I/O Interface
+// =============================================================================
+
+class IFileIO {
+public:
+    virtual ~IFileIO() = default;
+
+    // Non-copyable
+    IFileIO(const IFileIO&) = delete;
+    IFileIO& operator=(const IFileIO&) = delete;
+
+    /**
+     * Read a batch of whole files
+     *
+     * @param paths     Files to read
+     * @param callback  Called once per file as its contents become available
+     */
+    virtual void read_files(std::span<const std::filesystem::path> paths,
+                            const ReadCallback& callback) = 0;
+
+    /**
+     * Write a batch of whole files (created or truncated; hardlinked outputs
+     * are replaced, never written through)
+     *
+     * @param requests  Paths and contents to write
+     * @return          Per-request success flags (same order as requests)
+     */
+    [[nodiscard]] virtual std::vector<bool> write_files(
+        std::span<const FileWriteRequest> requests) = 0;
+
+    [[nodiscard]] virtual std::string_view name() const noexcept = 0;
+    [[nodiscard]] virtual IoBackendType type() const noexcept = 0;
+
+protected:
+    IFileIO() = default;
+};
+
+// =============================================================================
+// Synchronous Backend
+// =============================================================================
+
+class SyncFileIO final : public IFileIO {
+public:
+    SyncFileIO() = default;
+
+    void read_files(std::span<const std::filesystem::path> paths,
+                    const ReadCallback& callback) override;
+
+    [[nodiscard]] std::vector<bool> write_files(
+        std::span<const FileWriteRequest> requests) override;
+
+    [[nodiscard]] std::string_view name() const noexcept override { return "sync"; }
+    [[nodiscard]] IoBackendType type() const noexcept override { return IoBackendType::Sync; }
+
+private:
+    std::vector<uint8_t> buffer_;   // Reused across reads
+};
+
+// =============================================================================
+// Copy-Through
+// =============================================================================
+
+enum class CopyMethod {
+    None,           // Not copied (failure)
+    InPlace,        // Source and destination are already the same file
+    Hardlink,       // Same inode, same filesystem
+    Reflink,        // Copy-on-write clone (FICLONE / clonefile)
+    CopyRange,      // In-kernel copy (copy_file_range)
+    Copy            // Plain userspace copy
+};
+
+[[nodiscard]] constexpr std::string_view to_string(CopyMethod method) noexcept {
+    switch (method) {
+        case CopyMethod::None:      return "none";
+        case CopyMethod::InPlace:   return "in-place";
+        case CopyMethod::Hardlink:  return "hardlink";
+        case CopyMethod::Reflink:   return "reflink";
+        case CopyMethod::CopyRange: return "copy_file_range";
+        case CopyMethod::Copy:      return "copy";
+        default:                    return "unknown";
+    }
+}
+
+/**
+ * Materialize a file at a new path without decoding it
+ *
+ * Tries, in order: hardlink (if allow_hardlink), reflink clone, in-kernel
+ * copy_file_range, and finally a regular copy. An existing destination is
+ * replaced.
+ *
+ * @param src             Source file
+ * @param dst             Destination path
+ * @param allow_hardlink  Share the inode when both paths are on one filesystem
+ * @return                Method used, or CopyMethod::None on failure
+ */
+[[nodiscard]] CopyMethod copy_through(const std::filesystem::path& src,
+                                      const std::filesystem::path& dst,
+                                      bool allow_hardlink = false);
+
+/**
+ * Prepare an output path for a truncating write
+ *
+ * If the path is one of several hardlinks to an inode (e.g. an input copied
+ * through with allow_hardlink on an earlier run), it is unlinked so the write
+ * creates a new file instead of overwriting the shared one. Every writer
+ * that opens an existing output with truncation must call this first.
+ */
+void detach_hardlink(const std::filesystem::path& path);
+
+// =============================================================================
+// Factory
+// =============================================================================
+
+/**
+ * Create a file I/O backend
+ *
+ * Falls back to the synchronous backend if the requested one is not
+ * compiled in or cannot be initialized on this system. Auto resolves to
+ * the synchronous backend until io_uring is measured to be faster.
+ */
+[[nodiscard]] std::unique_ptr<IFileIO> create_file_io(IoBackendType type = IoBackendType::Auto);
+
+/**
+ * Check if a backend is compiled in and usable at runtime
+ */
+[[nodiscard]] bool is_io_backend_available(IoBackendType type);
+
+}  // namespace gwt
@@ -0,0 +1,483 @@
+/**
+ * @file    image_codec.cpp
+ * @brief   Image Encoding Profiles Implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Profile parameters per format:
+ *
+ *   Profile   | JPEG              | PNG                      | WebP
+ *   ----------+-------------------+--------------------------+---------------------
+ *   max       | Q100              | level 6                  | lossless
+ *   fast      | Q90               | level 1, RLE, fast filter| Q90, method 0
+ *   balanced  | Q95, optimized    | level 4, filtered        | Q92, method 4
+ *   smallest  | Q85, opt+progr.   | level 9, all filters     | Q85, method 6
+ *   match-in. | source Q/sampling | = balanced               | = balanced
+ *
+ * WebP method selection requires libwebp directly (GWT_HAS_LIBWEBP); the
+ * OpenCV WebP path only exposes quality. Large PNGs go through the
+ * multi-threaded writer in png_writer.cpp with the same settings.
+ *
+ * The same library gives read_image_region() a cropped WebP decode;
+ * OpenCV has no region decode for the other formats.
+ */
+
+#include "core/image_codec.hpp"
+#include "core/file_io.hpp"
+#include "core/png_writer.hpp"
+#include "utils/path_formatter.hpp"
+
+#include <opencv2/core/utility.hpp>
+#include <opencv2/core/version.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <spdlog/spdlog.h>
+
+#if defined(GWT_HAS_LIBWEBP)
+#include <webp/decode.h>
+#include <webp/encode.h>
+#endif
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <string>
+
+// IMWRITE_PNG_FILTER was added in OpenCV 4.11
+#if (CV_VERSION_MAJOR > 4) || (CV_VERSION_MAJOR == 4 && CV_VERSION_MINOR >= 11)
+    #define GWT_HAS_PNG_FILTER_PARAM 1
+#endif
+
+// IMWRITE_JPEG_SAMPLING_FACTOR was added in OpenCV 4.5.5
+#if (CV_VERSION_MAJOR > 4) || (CV_VERSION_MAJOR == 4 && \
+    (CV_VERSION_MINOR > 5 || (CV_VERSION_MINOR == 5 && CV_VERSION_REVISION >= 5)))
+    #define GWT_HAS_JPEG_SAMPLING_PARAM 1
+#endif
+
+namespace gwt {
+
+namespace {
+
+struct WebPSettings {
+    bool lossless;
+    float quality;      // 0-100
+    int method;         // 0 (fast) - 6 (slowest, smallest)
+};
+
+WebPSettings get_webp_settings(EncodeProfile profile) {
+    switch (profile) {
+        case EncodeProfile::Fast:       return {false, 90.0f, 0};
+        case EncodeProfile::Smallest:   return {false, 85.0f, 6};
+        case EncodeProfile::Balanced:
+        case EncodeProfile::MatchInput: return {false, 92.0f, 4};
+        case EncodeProfile::Max:
+        default:                        return {true, 100.0f, 4};
+    }
+}
+
+#if defined(GWT_HAS_LIBWEBP)
+/**
+ * Encode WebP via libwebp so that the method (speed/size) can be set
+ */
+bool encode_webp(const cv::Mat& image, const WebPSettings& settings,
+                 std::vector<uint8_t>& buffer) {
+    if (image.depth() != CV_8U || (image.channels() != 3 && image.channels() != 4)) {
+        return false;
+    }
+
+    WebPConfig config;
+    if (!WebPConfigInit(&config)) return false;
+    config.lossless = settings.lossless ? 1 : 0;
+    config.quality = settings.quality;
+    config.method = settings.method;
+    config.thread_level = 1;
+    if (!WebPValidateConfig(&config)) return false;
+
+    WebPPicture picture;
+    if (!WebPPictureInit(&picture)) return false;
+    picture.width = image.cols;
+    picture.height = image.rows;
+    picture.use_argb = config.lossless;
+
+    const cv::Mat src = image.isContinuous() ? image : image.clone();
+    const int stride = static_cast<int>(src.step[0]);
+    const int imported = (src.channels() == 4)
+        ? WebPPictureImportBGRA(&picture, src.data, stride)
+        : WebPPictureImportBGR(&picture, src.data, stride);
+    if (!imported) {
+        WebPPictureFree(&picture);
+        return false;
+    }
+
+    WebPMemoryWriter writer;
+    WebPMemoryWriterInit(&writer);
+    picture.writer = WebPMemoryWrite;
+    picture.custom_ptr = &writer;
+
+    const bool ok = WebPEncode(&config, &picture) != 0;
+    if (ok) {
+        buffer.assign(writer.mem, writer.mem + writer.size);
+    } else {
+        spdlog::debug("WebPEncode failed (error {})", static_cast<int>(picture.error_code));
+    }
+
+    WebPMemoryWriterClear(&writer);
+    WebPPictureFree(&picture);
+    return ok;
+}
+#endif
+
+/**
+ * JPEG parameters reproducing the source's quality and subsampling
+ */
+std::vector<int> get_match_jpeg_params(const JpegInfo& info) {
+    std::vector<int> params = {
+        cv::IMWRITE_JPEG_QUALITY, info.luma_quality,
+        cv::IMWRITE_JPEG_LUMA_QUALITY, info.luma_quality,
+        cv::IMWRITE_JPEG_CHROMA_QUALITY, info.chroma_quality.value_or(info.luma_quality),
+    };
+
+#if defined(GWT_HAS_JPEG_SAMPLING_PARAM)
+    int sampling = -1;
+    switch (info.subsampling) {
+        case ChromaSubsampling::S444: sampling = cv::IMWRITE_JPEG_SAMPLING_FACTOR_444; break;
+        case ChromaSubsampling::S422: sampling = cv::IMWRITE_JPEG_SAMPLING_FACTOR_422; break;
+        case ChromaSubsampling::S440: sampling = cv::IMWRITE_JPEG_SAMPLING_FACTOR_440; break;
+        case ChromaSubsampling::S420: sampling = cv::IMWRITE_JPEG_SAMPLING_FACTOR_420; break;
+        case ChromaSubsampling::S411: sampling = cv::IMWRITE_JPEG_SAMPLING_FACTOR_411; break;
+        default: break;
+    }
+    if (sampling >= 0) {
+        params.push_back(cv::IMWRITE_JPEG_SAMPLING_FACTOR);
+        params.push_back(sampling);
+    }
+#endif
+
+    if (info.progressive) {
+        params.push_back(cv::IMWRITE_JPEG_PROGRESSIVE);
+        params.push_back(1);
+    }
+    return params;
+}
+
+/**
+ * Parallel PNG writer settings matching the profile's OpenCV parameters
+ */
+PngWriteOptions get_png_options(EncodeProfile profile) {
+    PngWriteOptions options;
+    switch (profile) {
+        case EncodeProfile::Fast:
+            options.level = 1;
+            options.strategy = Z_RLE;
+            options.fast_filters = true;
+            break;
+        case EncodeProfile::Balanced:
+        case EncodeProfile::MatchInput:
+            options.level = 4;
+            options.strategy = Z_FILTERED;
+            break;
+        case EncodeProfile::Smallest:
+            options.level = 9;
+            break;
+        case EncodeProfile::Max:
+        default:
+            options.level = 6;
+            break;
+    }
+    return options;
+}
+
+#if defined(GWT_HAS_LIBWEBP)
+/**
+ * Decode only the area region_of() picks from a WebP stream (BGR)
+ *
+ * @return nullopt on failure, including animated WebP (not supported by
+ *         WebPDecode; the caller falls back to OpenCV)
+ */
+std::optional<ImageRegion> decode_webp_region(
+    std::span<const uint8_t> data,
+    const std::function<cv::Rect(cv::Size)>& region_of)
+{
+    WebPDecoderConfig config;
+    if (!WebPInitDecoderConfig(&config)) return std::nullopt;
+    if (WebPGetFeatures(data.data(), data.size(), &config.input) != VP8_STATUS_OK) {
+        return std::nullopt;
+    }
+
+    const cv::Size size(config.input.width, config.input.height);
+    cv::Rect rect = region_of(size) & cv::Rect(cv::Point(0, 0), size);
+    if (rect.empty()) return std::nullopt;
+
+    // Lossy streams are 4:2:0: the crop origin must be even
+    rect.width += rect.x & 1;
+    rect.x &= ~1;
+    rect.height += rect.y & 1;
+    rect.y &= ~1;
+
+    ImageRegion region{cv::Mat(rect.size(), CV_8UC3), size, rect.tl()};
+
+    config.options.use_cropping = 1;
+    config.options.crop_left = rect.x;
+    config.options.crop_top = rect.y;
+    config.options.crop_width = rect.width;
+    config.options.crop_height = rect.height;
+
+    // Decode straight into the Mat
+    config.output.colorspace = MODE_BGR;
+    config.output.is_external_memory = 1;
+    config.output.u.RGBA.rgba = region.pixels.data;
+    config.output.u.RGBA.stride = static_cast<int>(region.pixels.step[0]);
+    config.output.u.RGBA.size = region.pixels.total() * region.pixels.elemSize();
+
+    const VP8StatusCode status = WebPDecode(data.data(), data.size(), &config);
+    WebPFreeDecBuffer(&config.output);
+    if (status != VP8_STATUS_OK) {
+        spdlog::debug("WebPDecode (cropped) failed (status {})", static_cast<int>(status));
+        return std::nullopt;
+    }
+    return region;
+}
+
+std::vector<uint8_t> read_file_contents(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return {};
+
+    std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    if (!file) return {};
+    return data;
+}
+#endif
+
+const char* extension_for(ImageFormat format) {
+    switch (format) {
+        case ImageFormat::Jpeg: return ".jpg";
+        case ImageFormat::Png:  return ".png";
+        case ImageFormat::WebP: return ".webp";
+        case ImageFormat::Bmp:  return ".bmp";
+        default:                return nullptr;
+    }
+}
+
+}  // anonymous namespace
+
+// =============================================================================
+// Profiles
+// =============================================================================
+
+std::optional<EncodeProfile> parse_encode_profile(std::string_view name) {
+    for (EncodeProfile profile : kAllEncodeProfiles) {
+        if (name == to_string(profile)) return profile;
+    }
+    return std::nullopt;
+}
+
+ImageFormat format_from_path(const std::filesystem::path& path) {
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+    if (ext == ".jpg" || ext == ".jpeg") return ImageFormat::Jpeg;
+    if (ext == ".png")                   return ImageFormat::Png;
+    if (ext == ".webp")                  return ImageFormat::WebP;
+    if (ext == ".bmp")                   return ImageFormat::Bmp;
+    return ImageFormat::Unknown;
+}
+
+cv::Mat fit_to_max_dimension(const cv::Mat& image, int max_dimension) {
+    if (max_dimension <= 0 || (image.cols <= max_dimension && image.rows <= max_dimension)) {
+        return image;
+    }
+
+    const double scale = static_cast<double>(max_dimension) / std::max(image.cols, image.rows);
+    const cv::Size size(std::max(1, static_cast<int>(std::lround(image.cols * scale))),
+                        std::max(1, static_cast<int>(std::lround(image.rows * scale))));
+
+    cv::Mat resized;
+    cv::resize(image, resized, size, 0, 0, cv::INTER_AREA);
+    return resized;
+}
+
+EncodeSource probe_encode_source(std::span<const uint8_t> data) {
+    EncodeSource source;
+    if (data.size() >= 2 && data[0] == 0xFF && data[1] == 0xD8) {
+        source.format = ImageFormat::Jpeg;
+        source.jpeg = parse_jpeg_info(data);
+    } else if (data.size() >= 8 && data[0] == 0x89 && data[1] == 'P' &&
+               data[2] == 'N' && data[3] == 'G') {
+        source.format = ImageFormat::Png;
+    } else if (data.size() >= 12 && std::equal(data.begin(), data.begin() + 4, "RIFF") &&
+               std::equal(data.begin() + 8, data.begin() + 12, "WEBP")) {
+        source.format = ImageFormat::WebP;
+    } else if (data.size() >= 2 && data[0] == 'B' && data[1] == 'M') {
+        source.format = ImageFormat::Bmp;
+    }
+    return source;
+}
+
+EncodeSource probe_encode_source(const std::filesystem::path& path) {
+    EncodeSource source;
+    source.format = format_from_path(path);
+    if (source.format == ImageFormat::Jpeg) {
+        source.jpeg = read_jpeg_info(path);
+    }
+    return source;
+}
+
+std::vector<int> get_encode_params(ImageFormat format, EncodeProfile profile,
+                                   const EncodeSource& source) {
+    switch (format) {
+        case ImageFormat::Jpeg:
+            if (profile == EncodeProfile::MatchInput && source.jpeg) {
+                return get_match_jpeg_params(*source.jpeg);
+            }
+            switch (profile) {
+                case EncodeProfile::Fast:
+                    return {cv::IMWRITE_JPEG_QUALITY, 90};
+                case EncodeProfile::Balanced:
+                case EncodeProfile::MatchInput:
+                    return {cv::IMWRITE_JPEG_QUALITY, 95,
+                            cv::IMWRITE_JPEG_OPTIMIZE, 1};
+                case EncodeProfile::Smallest:
+                    return {cv::IMWRITE_JPEG_QUALITY, 85,
+                            cv::IMWRITE_JPEG_OPTIMIZE, 1,
+                            cv::IMWRITE_JPEG_PROGRESSIVE, 1};
+                case EncodeProfile::Max:
+                default:
+                    return {cv::IMWRITE_JPEG_QUALITY, 100};
+            }
+
+        case ImageFormat::Png:
+            switch (profile) {
+                case EncodeProfile::Fast:
+                    return {cv::IMWRITE_PNG_COMPRESSION, 1,
+                            cv::IMWRITE_PNG_STRATEGY, cv::IMWRITE_PNG_STRATEGY_RLE,
+#if defined(GWT_HAS_PNG_FILTER_PARAM)
+                            cv::IMWRITE_PNG_FILTER, cv::IMWRITE_PNG_FAST_FILTERS,
+#endif
+                    };
+                case EncodeProfile::Balanced:
+                case EncodeProfile::MatchInput:
+                    return {cv::IMWRITE_PNG_COMPRESSION, 4,
+                            cv::IMWRITE_PNG_STRATEGY, cv::IMWRITE_PNG_STRATEGY_FILTERED,
+#if defined(GWT_HAS_PNG_FILTER_PARAM)
+                            cv::IMWRITE_PNG_FILTER, cv::IMWRITE_PNG_FILTER_PAETH,
+#endif
+                    };
+                case EncodeProfile::Smallest:
+                    return {cv::IMWRITE_PNG_COMPRESSION, 9,
+                            cv::IMWRITE_PNG_STRATEGY, cv::IMWRITE_PNG_STRATEGY_DEFAULT,
+#if defined(GWT_HAS_PNG_FILTER_PARAM)
+                            cv::IMWRITE_PNG_FILTER, cv::IMWRITE_PNG_ALL_FILTERS,
+#endif
+                    };
+                case EncodeProfile::Max:
+                default:
+                    return {cv::IMWRITE_PNG_COMPRESSION, 6};
+            }
+
+        case ImageFormat::WebP: {
+            const WebPSettings settings = get_webp_settings(profile);
+            return {cv::IMWRITE_WEBP_QUALITY,
+                    settings.lossless ? 101 : static_cast<int>(settings.quality)};
+        }
+
+        default:
+            return {};
+    }
+}
+
+// =============================================================================
+// Encoding
+// =============================================================================
+
+bool encode_image(
+    const cv::Mat& image,
+    const std::filesystem::path& output_path,
+    std::vector<uint8_t>& buffer,
+    EncodeProfile profile,
+    const EncodeSource& source)
+{
+    const ImageFormat format = format_from_path(output_path);
+    const char* ext = extension_for(format);
+    if (!ext) {
+        spdlog::error("Unsupported output format: {}", output_path);
+        return false;
+    }
+
+#if defined(GWT_HAS_LIBWEBP)
+    // Max keeps OpenCV's lossless path so its output is unchanged
+    if (format == ImageFormat::WebP && profile != EncodeProfile::Max &&
+        encode_webp(image, get_webp_settings(profile), buffer)) {
+        return true;
+    }
+#endif
+
+    // Large PNGs: multi-threaded filter + deflate
+    if (format == ImageFormat::Png && image.total() >= kParallelPngMinPixels &&
+        cv::getNumThreads() > 1 &&
+        encode_png_parallel(image, buffer, get_png_options(profile))) {
+        return true;
+    }
+
+    return cv::imencode(ext, image, buffer, get_encode_params(format, profile, source));
+}
+
+bool write_image(
+    const cv::Mat& image,
+    const std::filesystem::path& output_path,
+    EncodeProfile profile,
+    const EncodeSource& source)
+{
+    std::vector<uint8_t> buffer;
+    if (!encode_image(image, output_path, buffer, profile, source)) {
+        return false;
+    }
+
+    auto output_dir = output_path.parent_path();
+    if (!output_dir.empty() && !std::filesystem::exists(output_dir)) {
+        std::filesystem::create_directories(output_dir);
+    }
+
+    detach_hardlink(output_path);
+    std::ofstream file(output_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(buffer.data()),
+               static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(file);
+}
+
+// =============================================================================
+// Decoding
+// =============================================================================
+
+std::optional<ImageRegion> read_image_region(
+    const std::filesystem::path& path,
+    const std::function<cv::Rect(cv::Size)>& region_of)
+{
+#if defined(GWT_HAS_LIBWEBP)
+    if (format_from_path(path) == ImageFormat::WebP) {
+        const std::vector<uint8_t> data = read_file_contents(path);
+        if (!data.empty()) {
+            if (auto region = decode_webp_region(data, region_of)) return region;
+        }
+    }
+#endif
+
+    const cv::Mat image = cv::imread(path.string(), cv::IMREAD_COLOR);
+    if (image.empty()) return std::nullopt;
+
+    const cv::Rect rect = region_of(image.size()) & cv::Rect(0, 0, image.cols, image.rows);
+    if (rect.empty()) return std::nullopt;
+
+    // Copy out the corner so the full frame is released here
+    return ImageRegion{image(rect).clone(), image.size(), rect.tl()};
+}
+
+}  // namespace gwt
@@ -0,0 +1,202 @@
+/**
+ * @file    image_codec.hpp
+ * @brief   Image Encoding Profiles
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Named speed/size trade-offs for JPEG, PNG and WebP output. The default
+ * profile (Max) keeps the historical settings: JPEG Q100, PNG level 6 and
+ * lossless WebP.
+ *
+ * Also decodes parts of images for callers that only look at a corner
+ * (batch detection pre-scan).
+ */
+
+#pragma once
+
+#include "core/jpeg_info.hpp"
+
+#include <opencv2/core.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace gwt {
+
+// =============================================================================
+// Formats and Profiles
+// =============================================================================
+
+enum class ImageFormat {
+    Jpeg,
+    Png,
+    WebP,
+    Bmp,
+    Unknown
+};
+
+enum class EncodeProfile {
+    Max,        // Highest fidelity (JPEG Q100, PNG level 6, lossless WebP)
+    Fast,       // Fastest encode, for transient intermediates
+    Balanced,   // Good quality at moderate cost
+    Smallest,   // Smallest files, slowest encode
+    MatchInput  // Mirror the input's encoding where it can be inferred
+};
+
+inline constexpr EncodeProfile kAllEncodeProfiles[] = {
+    EncodeProfile::Max,
+    EncodeProfile::Fast,
+    EncodeProfile::Balanced,
+    EncodeProfile::Smallest,
+    EncodeProfile::MatchInput,
+};
+
+[[nodiscard]] constexpr std::string_view to_string(EncodeProfile profile) noexcept {
+    switch (profile) {
+        case EncodeProfile::Max:        return "max";
+        case EncodeProfile::Fast:       return "fast";
+        case EncodeProfile::Balanced:   return "balanced";
+        case EncodeProfile::Smallest:   return "smallest";
+        case EncodeProfile::MatchInput: return "match-input";
+        default:                        return "unknown";
+    }
+}
+
+[[nodiscard]] constexpr std::string_view to_string(ImageFormat format) noexcept {
+    switch (format) {
+        case ImageFormat::Jpeg:    return "jpeg";
+        case ImageFormat::Png:     return "png";
+        case ImageFormat::WebP:    return "webp";
+        case ImageFormat::Bmp:     return "bmp";
+        case ImageFormat::Unknown: return "unknown";
+        default:                   return "unknown";
+    }
+}
+
+/**
+ * Parse a profile name ("max", "fast", "balanced", "smallest", "match-input")
+ */
+[[nodiscard]] std::optional<EncodeProfile> parse_encode_profile(std::string_view name);
+
+/**
+ * Determine the output format from a path's extension
+ */
+[[nodiscard]] ImageFormat format_from_path(const std::filesystem::path& path);
+
+/**
+ * One output to produce from a processed frame
+ */
+struct OutputSpec {
+    std::filesystem::path path;                 // Format is taken from the extension
+    EncodeProfile profile = EncodeProfile::Max;
+    int max_dimension = 0;                      // Downscale to fit (0 = original size)
+};
+
+/**
+ * Downscale so that neither side exceeds max_dimension (INTER_AREA)
+ *
+ * Returns the input unchanged if max_dimension is 0 or already satisfied.
+ */
+[[nodiscard]] cv::Mat fit_to_max_dimension(const cv::Mat& image, int max_dimension);
+
+// =============================================================================
+// Source Encoding (for MatchInput)
+// =============================================================================
+
+/**
+ * What is known about how the input file was encoded
+ */
+struct EncodeSource {
+    ImageFormat format = ImageFormat::Unknown;
+    std::optional<JpegInfo> jpeg;       // Set when the input is a parseable JPEG
+};
+
+/**
+ * Inspect an input file's encoding from its contents (headers only)
+ */
+[[nodiscard]] EncodeSource probe_encode_source(std::span<const uint8_t> data);
+
+/**
+ * Inspect an input file's encoding (reads only the header area)
+ */
+[[nodiscard]] EncodeSource probe_encode_source(const std::filesystem::path& path);
+
+// =============================================================================
+// Encoding
+// =============================================================================
+
+/**
+ * Get OpenCV imwrite/imencode parameters for a format and profile
+ *
+ * MatchInput uses the source's JPEG quality and subsampling when both input
+ * and output are JPEG; otherwise it falls back to Balanced.
+ */
+[[nodiscard]] std::vector<int> get_encode_params(ImageFormat format, EncodeProfile profile,
+                                                 const EncodeSource& source = {});
+
+/**
+ * Encode an image into memory using the format implied by the output path
+ *
+ * @param image        Image to encode
+ * @param output_path  Output path (only the extension is used)
+ * @param buffer       Receives the encoded file contents
+ * @param profile      Encode profile
+ * @param source       Input encoding (used by MatchInput)
+ * @return             true on success
+ */
+bool encode_image(
+    const cv::Mat& image,
+    const std::filesystem::path& output_path,
+    std::vector<uint8_t>& buffer,
+    EncodeProfile profile = EncodeProfile::Max,
+    const EncodeSource& source = {}
+);
+
+/**
+ * Encode and write an image, creating the parent directory if needed
+ *
+ * @return true on success
+ */
+bool write_image(
+    const cv::Mat& image,
+    const std::filesystem::path& output_path,
+    EncodeProfile profile = EncodeProfile::Max,
+    const EncodeSource& source = {}
+);
+
+// =============================================================================
+// Decoding
+// =============================================================================
+
+/**
+ * Part of a decoded image
+ */
+struct ImageRegion {
+    cv::Mat pixels;             // BGR pixels of the region
+    cv::Size image_size;        // Size of the whole image
+    cv::Point origin;           // Top-left of pixels within the image
+};
+
+/**
+ * Decode the part of an image file chosen by region_of(image size)
+ *
+ * With libwebp (GWT_HAS_LIBWEBP) still WebP files are decoded with
+ * cropping, so only the requested rows are converted and allocated. Other
+ * formats are decoded whole by OpenCV and cropped right away.
+ *
+ * @param path       Image file
+ * @param region_of  Area wanted for an image of the given size (clipped to it)
+ * @return           nullopt if the file cannot be decoded or the area is empty
+ */
+[[nodiscard]] std::optional<ImageRegion> read_image_region(
+    const std::filesystem::path& path,
+    const std::function<cv::Rect(cv::Size)>& region_of
+);
+
+}  // namespace gwt
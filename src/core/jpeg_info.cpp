@@ -0,0 +1,206 @@
+/**
+ * @file    jpeg_info.cpp
+ * @brief   JPEG Header Inspection Implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Quality estimation inverts libjpeg's jpeg_quality_scaling():
+ *   scale = (Q < 50) ? 5000 / Q : 200 - 2 * Q
+ *   q[i]  = clamp((std[i] * scale + 50) / 100, 1, 255)
+ * The mean of q[i] * 100 / std[i] over all 64 coefficients recovers the
+ * scale factor, which maps back to Q. Tables that did not come from the
+ * IJG formula still get the closest equivalent quality.
+ */
+
+#include "core/jpeg_info.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+namespace gwt {
+
+namespace {
+
+// Annex K standard tables (natural order)
+constexpr std::array<uint16_t, 64> kStdLuma = {
+    16,  11,  10,  16,  24,  40,  51,  61,
+    12,  12,  14,  19,  26,  58,  60,  55,
+    14,  13,  16,  24,  40,  57,  69,  56,
+    14,  17,  22,  29,  51,  87,  80,  62,
+    18,  22,  37,  56,  68, 109, 103,  77,
+    24,  35,  55,  64,  81, 104, 113,  92,
+    49,  64,  78,  87, 103, 121, 120, 101,
+    72,  92,  95,  98, 112, 100, 103,  99,
+};
+
+constexpr std::array<uint16_t, 64> kStdChroma = {
+    17,  18,  24,  47,  99,  99,  99,  99,
+    18,  21,  26,  66,  99,  99,  99,  99,
+    24,  26,  56,  99,  99,  99,  99,  99,
+    47,  66,  99,  99,  99,  99,  99,  99,
+    99,  99,  99,  99,  99,  99,  99,  99,
+    99,  99,  99,  99,  99,  99,  99,  99,
+    99,  99,  99,  99,  99,  99,  99,  99,
+    99,  99,  99,  99,  99,  99,  99,  99,
+};
+
+// Zigzag position -> natural (row-major) index
+constexpr std::array<uint8_t, 64> kZigzagToNatural = {
+     0,  1,  8, 16,  9,  2,  3, 10,
+    17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34,
+    27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36,
+    29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46,
+    53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+// Header bytes read from a file; enough for EXIF/ICC-heavy headers
+constexpr size_t kMaxHeaderBytes = 256 * 1024;
+
+ChromaSubsampling classify_sampling(int components, int h0, int v0, int h1, int v1) {
+    if (components == 1) return ChromaSubsampling::Gray;
+    if (h1 != 1 || v1 != 1) return ChromaSubsampling::Other;
+
+    if (h0 == 1 && v0 == 1) return ChromaSubsampling::S444;
+    if (h0 == 2 && v0 == 1) return ChromaSubsampling::S422;
+    if (h0 == 1 && v0 == 2) return ChromaSubsampling::S440;
+    if (h0 == 2 && v0 == 2) return ChromaSubsampling::S420;
+    if (h0 == 4 && v0 == 1) return ChromaSubsampling::S411;
+    return ChromaSubsampling::Other;
+}
+
+}  // anonymous namespace
+
+int estimate_jpeg_quality(std::span<const uint16_t, 64> table, bool chroma) {
+    const auto& reference = chroma ? kStdChroma : kStdLuma;
+
+    if (std::all_of(table.begin(), table.end(), [](uint16_t q) { return q <= 1; })) {
+        return 100;
+    }
+
+    double scale_sum = 0.0;
+    for (size_t zz = 0; zz < 64; ++zz) {
+        const uint16_t ref = reference[kZigzagToNatural[zz]];
+        scale_sum += static_cast<double>(table[zz]) * 100.0 / ref;
+    }
+    const double scale = scale_sum / 64.0;
+
+    const double quality = (scale <= 100.0)
+        ? (200.0 - scale) / 2.0
+        : 5000.0 / scale;
+
+    return std::clamp(static_cast<int>(std::lround(quality)), 1, 100);
+}
+
+std::optional<JpegInfo> parse_jpeg_info(std::span<const uint8_t> data) {
+    if (data.size() < 4 || data[0] != 0xFF || data[1] != 0xD8) {
+        return std::nullopt;
+    }
+
+    std::array<std::array<uint16_t, 64>, 4> tables{};
+    std::array<bool, 4> has_table{};
+    std::array<int, 3> component_table{};   // Quantization table per component
+
+    JpegInfo info;
+    bool has_sof = false;
+    int h0 = 1, v0 = 1, h1 = 1, v1 = 1;
+
+    size_t pos = 2;
+    while (pos + 4 <= data.size()) {
+        if (data[pos] != 0xFF) return std::nullopt;
+        const uint8_t marker = data[pos + 1];
+
+        // Fill bytes and standalone markers
+        if (marker == 0xFF) { ++pos; continue; }
+        if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) { pos += 2; continue; }
+
+        const size_t length = (static_cast<size_t>(data[pos + 2]) << 8) | data[pos + 3];
+        if (length < 2) return std::nullopt;
+        const size_t body = pos + 4;
+        const size_t end = pos + 2 + length;
+
+        if (marker == 0xDA || marker == 0xD9) {
+            break;  // SOS / EOI: headers done
+        }
+        if (end > data.size()) {
+            break;  // Truncated header area
+        }
+
+        if (marker == 0xDB) {
+            // DQT: one or more tables
+            size_t p = body;
+            while (p < end) {
+                const int precision = data[p] >> 4;
+                const int id = data[p] & 0x0F;
+                ++p;
+                const size_t entry_size = precision ? 2 : 1;
+                if (id > 3 || p + 64 * entry_size > end) return std::nullopt;
+
+                for (size_t i = 0; i < 64; ++i) {
+                    tables[id][i] = precision
+                        ? static_cast<uint16_t>((data[p + 2 * i] << 8) | data[p + 2 * i + 1])
+                        : data[p + i];
+                }
+                has_table[id] = true;
+                p += 64 * entry_size;
+            }
+        } else if ((marker >= 0xC0 && marker <= 0xC3) || (marker >= 0xC5 && marker <= 0xC7) ||
+                   (marker >= 0xC9 && marker <= 0xCB) || (marker >= 0xCD && marker <= 0xCF)) {
+            // SOFn
+            if (length < 8) return std::nullopt;
+            info.height = (data[body + 1] << 8) | data[body + 2];
+            info.width = (data[body + 3] << 8) | data[body + 4];
+            info.components = data[body + 5];
+            info.progressive = (marker == 0xC2 || marker == 0xC6 ||
+                                marker == 0xCA || marker == 0xCE);
+
+            const int n = std::min(info.components, 3);
+            if (body + 6 + 3 * static_cast<size_t>(n) > end) return std::nullopt;
+            for (int c = 0; c < n; ++c) {
+                const uint8_t sampling = data[body + 6 + 3 * c + 1];
+                component_table[c] = data[body + 6 + 3 * c + 2] & 0x03;
+                if (c == 0) { h0 = sampling >> 4; v0 = sampling & 0x0F; }
+                if (c == 1) { h1 = sampling >> 4; v1 = sampling & 0x0F; }
+            }
+            has_sof = true;
+        }
+
+        pos = end;
+    }
+
+    if (!has_sof || !has_table[component_table[0]]) {
+        return std::nullopt;
+    }
+
+    info.luma_quality = estimate_jpeg_quality(tables[component_table[0]], false);
+
+    if (info.components >= 3) {
+        const int chroma_id = component_table[1];
+        if (chroma_id != component_table[0] && has_table[chroma_id]) {
+            info.chroma_quality = estimate_jpeg_quality(tables[chroma_id], true);
+        }
+    }
+
+    info.subsampling = classify_sampling(info.components, h0, v0, h1, v1);
+    return info;
+}
+
+std::optional<JpegInfo> read_jpeg_info(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return std::nullopt;
+
+    std::vector<uint8_t> header(kMaxHeaderBytes);
+    file.read(reinterpret_cast<char*>(header.data()),
+              static_cast<std::streamsize>(header.size()));
+    header.resize(static_cast<size_t>(file.gcount()));
+
+    return parse_jpeg_info(header);
+}
+
+}  // namespace gwt
@@ -0,0 +1,81 @@
+/**
+ * @file    jpeg_info.hpp
+ * @brief   JPEG Header Inspection
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Parses the marker segments of a JPEG stream up to the first SOS to
+ * recover the encoder settings: IJG-equivalent quality of the luma and
+ * chroma quantization tables (DQT), and the chroma subsampling (SOF).
+ * Used by the match-input encode profile so re-encoded JPEGs keep roughly
+ * the size and fidelity of their source instead of jumping to Q100.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace gwt {
+
+enum class ChromaSubsampling {
+    S444,       // No subsampling
+    S422,       // Horizontal 2x
+    S440,       // Vertical 2x
+    S420,       // Both 2x
+    S411,       // Horizontal 4x
+    Gray,       // Single component
+    Other
+};
+
+[[nodiscard]] constexpr std::string_view to_string(ChromaSubsampling s) noexcept {
+    switch (s) {
+        case ChromaSubsampling::S444:  return "4:4:4";
+        case ChromaSubsampling::S422:  return "4:2:2";
+        case ChromaSubsampling::S440:  return "4:4:0";
+        case ChromaSubsampling::S420:  return "4:2:0";
+        case ChromaSubsampling::S411:  return "4:1:1";
+        case ChromaSubsampling::Gray:  return "gray";
+        case ChromaSubsampling::Other: return "other";
+        default:                       return "unknown";
+    }
+}
+
+struct JpegInfo {
+    int width = 0;
+    int height = 0;
+    int components = 0;
+    bool progressive = false;
+
+    int luma_quality = 0;                   // Estimated IJG quality (1-100)
+    std::optional<int> chroma_quality;      // Absent for grayscale / single table
+    ChromaSubsampling subsampling = ChromaSubsampling::Other;
+};
+
+/**
+ * Parse JPEG headers from memory
+ *
+ * @param data  Start of the JPEG stream (headers up to SOS are enough)
+ * @return      Parsed info, or nullopt if not a JPEG / no DQT+SOF before SOS
+ */
+[[nodiscard]] std::optional<JpegInfo> parse_jpeg_info(std::span<const uint8_t> data);
+
+/**
+ * Read and parse JPEG headers from a file (reads only the header area)
+ */
+[[nodiscard]] std::optional<JpegInfo> read_jpeg_info(const std::filesystem::path& path);
+
+/**
+ * Estimate the IJG quality that produced a quantization table
+ *
+ * @param table      64 entries in zigzag order (as stored in DQT)
+ * @param chroma     Compare against the standard chroma table instead of luma
+ * @return           Quality in [1, 100]
+ */
+[[nodiscard]] int estimate_jpeg_quality(std::span<const uint16_t, 64> table, bool chroma);
+
+}  // namespace gwt
@@ -0,0 +1,289 @@
+/**
+ * @file    png_writer.cpp
+ * @brief   Multi-threaded PNG Encoder Implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#include "core/png_writer.hpp"
+
+#include <opencv2/core/utility.hpp>
+#include <zlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+namespace gwt {
+
+namespace {
+
+constexpr size_t kDictionarySize = 32 * 1024;   // Deflate window
+
+enum PngFilter : uint8_t {
+    kFilterNone = 0,
+    kFilterSub = 1,
+    kFilterUp = 2,
+    kFilterAvg = 3,
+    kFilterPaeth = 4,
+};
+
+// =============================================================================
+// Row filtering
+// =============================================================================
+
+inline uint8_t paeth(int a, int b, int c) {
+    const int p = a + b - c;
+    const int pa = std::abs(p - a);
+    const int pb = std::abs(p - b);
+    const int pc = std::abs(p - c);
+    if (pa <= pb && pa <= pc) return static_cast<uint8_t>(a);
+    if (pb <= pc) return static_cast<uint8_t>(b);
+    return static_cast<uint8_t>(c);
+}
+
+/**
+ * Apply one filter to a row; returns the libpng-style cost heuristic
+ * (sum of absolute values of the output bytes interpreted as signed)
+ */
+size_t apply_filter(PngFilter filter, const uint8_t* cur, const uint8_t* prev,
+                    size_t length, size_t bpp, uint8_t* out) {
+    size_t cost = 0;
+    for (size_t i = 0; i < length; ++i) {
+        const int x = cur[i];
+        const int a = (i >= bpp) ? cur[i - bpp] : 0;
+        const int b = prev ? prev[i] : 0;
+        const int c = (prev && i >= bpp) ? prev[i - bpp] : 0;
+
+        uint8_t v;
+        switch (filter) {
+            case kFilterSub:   v = static_cast<uint8_t>(x - a); break;
+            case kFilterUp:    v = static_cast<uint8_t>(x - b); break;
+            case kFilterAvg:   v = static_cast<uint8_t>(x - ((a + b) >> 1)); break;
+            case kFilterPaeth: v = static_cast<uint8_t>(x - paeth(a, b, c)); break;
+            case kFilterNone:
+            default:           v = static_cast<uint8_t>(x); break;
+        }
+        out[i] = v;
+        cost += static_cast<size_t>(std::abs(static_cast<int8_t>(v)));
+    }
+    return cost;
+}
+
+/**
+ * Copy one image row into PNG channel order (BGR -> RGB, BGRA -> RGBA)
+ */
+void to_png_order(const uint8_t* src, size_t width, int channels, uint8_t* dst) {
+    if (channels == 1) {
+        std::memcpy(dst, src, width);
+        return;
+    }
+    for (size_t x = 0; x < width; ++x) {
+        const uint8_t* s = src + x * channels;
+        uint8_t* d = dst + x * channels;
+        d[0] = s[2];
+        d[1] = s[1];
+        d[2] = s[0];
+        if (channels == 4) d[3] = s[3];
+    }
+}
+
+// =============================================================================
+// PNG chunk output
+// =============================================================================
+
+void put_u32(std::vector<uint8_t>& out, uint32_t v) {
+    out.push_back(static_cast<uint8_t>(v >> 24));
+    out.push_back(static_cast<uint8_t>(v >> 16));
+    out.push_back(static_cast<uint8_t>(v >> 8));
+    out.push_back(static_cast<uint8_t>(v));
+}
+
+void write_chunk(std::vector<uint8_t>& out, const char type[4],
+                 const uint8_t* data, size_t length) {
+    put_u32(out, static_cast<uint32_t>(length));
+    const size_t type_pos = out.size();
+    out.insert(out.end(), type, type + 4);
+    if (length > 0) {
+        out.insert(out.end(), data, data + length);
+    }
+
+    const uLong crc = crc32(0L, out.data() + type_pos, static_cast<uInt>(4 + length));
+    put_u32(out, static_cast<uint32_t>(crc));
+}
+
+}  // anonymous namespace
+
+bool encode_png_parallel(const cv::Mat& image, std::vector<uint8_t>& out,
+                         const PngWriteOptions& options) {
+    const int channels = image.channels();
+    if (image.empty() || image.depth() != CV_8U ||
+        (channels != 1 && channels != 3 && channels != 4)) {
+        return false;
+    }
+
+    const size_t width = static_cast<size_t>(image.cols);
+    const size_t height = static_cast<size_t>(image.rows);
+    const size_t row_bytes = width * static_cast<size_t>(channels);
+    const size_t filtered_stride = row_bytes + 1;
+    const size_t bpp = static_cast<size_t>(channels);
+
+    // -------------------------------------------------------------------------
+    // 1. Filter rows in parallel (each row only needs the row above)
+    // -------------------------------------------------------------------------
+    std::vector<uint8_t> filtered(filtered_stride * height);
+
+    cv::parallel_for_(cv::Range(0, image.rows), [&](const cv::Range& range) {
+        std::vector<uint8_t> cur(row_bytes), prev(row_bytes);
+        std::vector<uint8_t> trial(row_bytes);
+
+        if (range.start > 0) {
+            to_png_order(image.ptr<uint8_t>(range.start - 1), width, channels, prev.data());
+        }
+
+        for (int y = range.start; y < range.end; ++y) {
+            to_png_order(image.ptr<uint8_t>(y), width, channels, cur.data());
+            const uint8_t* above = (y > 0) ? prev.data() : nullptr;
+            uint8_t* dst = filtered.data() + static_cast<size_t>(y) * filtered_stride;
+
+            // Adaptive selection: keep the filter with the lowest cost
+            PngFilter best = kFilterNone;
+            size_t best_cost = apply_filter(kFilterNone, cur.data(), above,
+                                            row_bytes, bpp, dst + 1);
+
+            const PngFilter candidates[] = {kFilterSub, kFilterUp, kFilterAvg, kFilterPaeth};
+            const size_t candidate_count = options.fast_filters ? 2 : 4;
+            for (size_t k = 0; k < candidate_count; ++k) {
+                const size_t cost = apply_filter(candidates[k], cur.data(), above,
+                                                 row_bytes, bpp, trial.data());
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best = candidates[k];
+                    std::memcpy(dst + 1, trial.data(), row_bytes);
+                }
+            }
+            dst[0] = best;
+
+            std::swap(cur, prev);
+        }
+    });
+
+    // -------------------------------------------------------------------------
+    // 2. Deflate slices in parallel, chained through preset dictionaries
+    // -------------------------------------------------------------------------
+    const size_t total = filtered.size();
+    const size_t slice_size = std::max(options.slice_size, kDictionarySize);
+    const size_t slice_count = (total + slice_size - 1) / slice_size;
+
+    std::vector<std::vector<uint8_t>> slices(slice_count);
+    std::vector<uLong> slice_adler(slice_count);
+    std::atomic<bool> ok{true};
+
+    cv::parallel_for_(cv::Range(0, static_cast<int>(slice_count)), [&](const cv::Range& range) {
+        for (int s = range.start; s < range.end; ++s) {
+            const size_t start = static_cast<size_t>(s) * slice_size;
+            const size_t length = std::min(slice_size, total - start);
+            const bool last = (static_cast<size_t>(s) + 1 == slice_count);
+            const uint8_t* input = filtered.data() + start;
+
+            z_stream zs{};
+            if (deflateInit2(&zs, options.level, Z_DEFLATED, -MAX_WBITS, 8,
+                             options.strategy) != Z_OK) {
+                ok = false;
+                continue;
+            }
+
+            if (start > 0) {
+                const size_t dict_len = std::min(kDictionarySize, start);
+                deflateSetDictionary(&zs, input - dict_len, static_cast<uInt>(dict_len));
+            }
+
+            // Bound plus room for the sync-flush marker
+            auto& slice = slices[static_cast<size_t>(s)];
+            slice.resize(deflateBound(&zs, static_cast<uLong>(length)) + 64);
+
+            zs.next_in = const_cast<Bytef*>(input);
+            zs.avail_in = static_cast<uInt>(length);
+            zs.next_out = slice.data();
+            zs.avail_out = static_cast<uInt>(slice.size());
+
+            // Non-final slices end byte-aligned on an empty stored block
+            const int ret = deflate(&zs, last ? Z_FINISH : Z_SYNC_FLUSH);
+            const bool slice_ok = last ? (ret == Z_STREAM_END)
+                                       : (ret == Z_OK && zs.avail_in == 0 && zs.avail_out > 0);
+            if (!slice_ok) {
+                ok = false;
+            }
+            slice.resize(zs.total_out);
+            deflateEnd(&zs);
+
+            slice_adler[static_cast<size_t>(s)] =
+                adler32(adler32(0L, Z_NULL, 0), input, static_cast<uInt>(length));
+        }
+    });
+
+    if (!ok) {
+        return false;
+    }
+
+    uLong adler = adler32(0L, Z_NULL, 0);
+    for (size_t s = 0; s < slice_count; ++s) {
+        const size_t length = std::min(slice_size, total - s * slice_size);
+        adler = adler32_combine(adler, slice_adler[s], static_cast<z_off_t>(length));
+    }
+
+    // -------------------------------------------------------------------------
+    // 3. Assemble PNG: signature, IHDR, IDAT per slice, IEND
+    // -------------------------------------------------------------------------
+    size_t compressed = 0;
+    for (const auto& slice : slices) compressed += slice.size();
+
+    out.clear();
+    out.reserve(compressed + 12 * (slice_count + 4) + 64);
+
+    static constexpr uint8_t kSignature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    out.insert(out.end(), std::begin(kSignature), std::end(kSignature));
+
+    uint8_t ihdr[13];
+    const auto put_be32 = [](uint8_t* p, uint32_t v) {
+        p[0] = static_cast<uint8_t>(v >> 24);
+        p[1] = static_cast<uint8_t>(v >> 16);
+        p[2] = static_cast<uint8_t>(v >> 8);
+        p[3] = static_cast<uint8_t>(v);
+    };
+    put_be32(ihdr + 0, static_cast<uint32_t>(width));
+    put_be32(ihdr + 4, static_cast<uint32_t>(height));
+    ihdr[8] = 8;                                            // Bit depth
+    ihdr[9] = (channels == 1) ? 0 : (channels == 3) ? 2 : 6; // Gray / RGB / RGBA
+    ihdr[10] = 0;                                           // Deflate
+    ihdr[11] = 0;                                           // Adaptive filtering
+    ihdr[12] = 0;                                           // No interlace
+    write_chunk(out, "IHDR", ihdr, sizeof(ihdr));
+
+    // zlib header: 32K window, FLEVEL from the compression level
+    const uint8_t cmf = 0x78;
+    const int flevel = (options.level < 2) ? 0 : (options.level < 6) ? 1
+                     : (options.level == 6) ? 2 : 3;
+    uint8_t flg = static_cast<uint8_t>(flevel << 6);
+    flg = static_cast<uint8_t>(flg + 31 - ((cmf * 256 + flg) % 31));
+
+    for (size_t s = 0; s < slice_count; ++s) {
+        auto& slice = slices[s];
+        if (s == 0) {
+            slice.insert(slice.begin(), {cmf, flg});
+        }
+        if (s + 1 == slice_count) {
+            uint8_t trailer[4];
+            put_be32(trailer, static_cast<uint32_t>(adler));
+            slice.insert(slice.end(), std::begin(trailer), std::end(trailer));
+        }
+        write_chunk(out, "IDAT", slice.data(), slice.size());
+        std::vector<uint8_t>().swap(slice);
+    }
+
+    write_chunk(out, "IEND", nullptr, 0);
+    return true;
+}
+
+}  // namespace gwt
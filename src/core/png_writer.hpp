@@ -0,0 +1,49 @@
+/**
+ * @file    png_writer.hpp
+ * @brief   Multi-threaded PNG Encoder
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * libpng (as used by cv::imencode) filters and deflates on one thread,
+ * which makes PNG output the serial tail for large images. This writer
+ * filters rows in parallel, then compresses fixed-size slices of the
+ * filtered stream independently (pigz-style): each slice is primed with
+ * the previous slice's last 32 KiB as a preset dictionary and ends on a
+ * byte boundary, so the slices concatenate into a single valid zlib
+ * stream. Adler-32 is computed per slice and joined with adler32_combine.
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace gwt {
+
+struct PngWriteOptions {
+    int level = 6;                  // zlib compression level (1-9)
+    int strategy = 0;               // zlib strategy (Z_DEFAULT_STRATEGY, Z_FILTERED, Z_RLE, ...)
+    bool fast_filters = false;      // Choose among None/Sub/Up only (skip Avg/Paeth)
+    size_t slice_size = 256 * 1024; // Uncompressed bytes per deflate slice
+};
+
+/**
+ * Images at or above this pixel count use the parallel writer
+ */
+inline constexpr size_t kParallelPngMinPixels = 2 * 1024 * 1024;
+
+/**
+ * Encode an 8-bit 1/3/4-channel (Gray/BGR/BGRA) image as PNG
+ *
+ * @param image    Input image
+ * @param out      Receives the PNG file contents
+ * @param options  Compression options
+ * @return         false for unsupported input (caller should fall back)
+ */
+bool encode_png_parallel(const cv::Mat& image, std::vector<uint8_t>& out,
+                         const PngWriteOptions& options = {});
+
+}  // namespace gwt
@@ -0,0 +1,471 @@
+/**
+ * @file    uring_file_io.cpp
+ * @brief   io_uring File I/O Backend Implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * open()/fstat() stay synchronous (they are cheap and need the size up
+ * front); the data transfer is what gets batched. Each in-flight read owns
+ * one pool slot, and a slot is refilled with the next file as soon as its
+ * completion has been handed to the callback, keeping the ring full.
+ */
+
+#include "core/uring_file_io.hpp"
+#include "utils/path_formatter.hpp"
+
+#include <liburing.h>
+#include <spdlog/spdlog.h>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace gwt {
+
+namespace {
+
+// Per-SQE transfer cap (the length field is 32-bit); larger files loop
+constexpr size_t kMaxTransfer = size_t{1} << 30;
+
+// Failed waits tolerated while reaping cancelled requests
+constexpr int kMaxDrainErrors = 8;
+
+struct ReadSlot {
+    int fd = -1;
+    size_t index = 0;                 // Index into the request list
+    size_t size = 0;                  // Total file size
+    size_t done = 0;                  // Bytes read so far
+    uint8_t* data = nullptr;          // Pool slot or heap buffer
+    std::vector<uint8_t> heap;        // Used when the file exceeds kSlotSize
+    bool fixed = false;               // data points into a registered buffer
+    bool busy = false;
+};
+
+struct WriteOp {
+    int fd = -1;
+    size_t done = 0;
+    bool busy = false;
+};
+
+void close_fd(int& fd) {
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+}  // anonymous namespace
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+UringFileIO::UringFileIO() = default;
+
+UringFileIO::~UringFileIO() {
+    shutdown();
+}
+
+void UringFileIO::shutdown() {
+    if (!initialized_) return;
+
+    if (fixed_buffers_) {
+        io_uring_unregister_buffers(ring_.get());
+        fixed_buffers_ = false;
+    }
+    // Exiting the ring cancels and waits for anything still in flight
+    io_uring_queue_exit(ring_.get());
+    ring_.reset();
+    initialized_ = false;
+}
+
+void UringFileIO::abandon_in_flight(const std::vector<void*>& requests) {
+    if (requests.empty()) return;
+    io_uring* ring = ring_.get();
+
+    bool drained = true;
+    for (void* data : requests) {
+        io_uring_sqe* sqe = io_uring_get_sqe(ring);
+        if (!sqe) {
+            io_uring_submit(ring);
+            sqe = io_uring_get_sqe(ring);
+        }
+        if (!sqe) {
+            drained = false;
+            break;
+        }
+        io_uring_prep_cancel(sqe, data, 0);
+        io_uring_sqe_set_data(sqe, nullptr);    // The cancel's own completion
+    }
+    io_uring_submit(ring);
+
+    // Every original request completes exactly once (cancelled or not)
+    size_t remaining = requests.size();
+    int errors = 0;
+    while (drained && remaining > 0) {
+        io_uring_cqe* cqe = nullptr;
+        const int ret = io_uring_wait_cqe(ring, &cqe);
+        if (ret < 0) {
+            if (ret != -EINTR && ++errors > kMaxDrainErrors) drained = false;
+            continue;
+        }
+        if (io_uring_cqe_get_data(cqe) != nullptr) --remaining;
+        io_uring_cqe_seen(ring, cqe);
+    }
+
+    if (!drained) {
+        spdlog::error("io_uring: could not reap {} cancelled requests, "
+                      "falling back to synchronous I/O", remaining);
+        shutdown();
+    }
+}
+
+bool UringFileIO::init() {
+    if (initialized_) return true;
+
+    ring_ = std::make_unique<io_uring>();
+    const int ret = io_uring_queue_init(kQueueDepth, ring_.get(), 0);
+    if (ret < 0) {
+        spdlog::debug("io_uring_queue_init failed: {}", std::strerror(-ret));
+        ring_.reset();
+        return false;
+    }
+    initialized_ = true;
+
+    // Allocate the read pool and try to register it. Registration can fail
+    // under a low RLIMIT_MEMLOCK; regular reads into the same slots still work.
+    std::vector<iovec> iovecs(kSlotCount);
+    slots_.reserve(kSlotCount);
+    for (size_t i = 0; i < kSlotCount; ++i) {
+        slots_.push_back(std::make_unique<uint8_t[]>(kSlotSize));
+        iovecs[i].iov_base = slots_.back().get();
+        iovecs[i].iov_len = kSlotSize;
+    }
+
+    const int reg = io_uring_register_buffers(ring_.get(), iovecs.data(),
+                                              static_cast<unsigned>(iovecs.size()));
+    fixed_buffers_ = (reg == 0);
+    if (!fixed_buffers_) {
+        spdlog::debug("io_uring buffer registration failed ({}), using plain reads",
+                      std::strerror(-reg));
+    }
+
+    spdlog::debug("io_uring initialized: depth={}, {} x {} MiB buffers ({})",
+                  kQueueDepth, kSlotCount, kSlotSize / (1024 * 1024),
+                  fixed_buffers_ ? "registered" : "unregistered");
+    return true;
+}
+
+bool UringFileIO::is_supported() {
+    io_uring ring{};
+    if (io_uring_queue_init(2, &ring, 0) < 0) {
+        return false;
+    }
+
+    bool supported = false;
+    if (io_uring_probe* probe = io_uring_get_probe_ring(&ring)) {
+        supported = io_uring_opcode_supported(probe, IORING_OP_READ) &&
+                    io_uring_opcode_supported(probe, IORING_OP_WRITE);
+        io_uring_free_probe(probe);
+    }
+
+    io_uring_queue_exit(&ring);
+    return supported;
+}
+
+// =============================================================================
+// Reads
+// =============================================================================
+
+void UringFileIO::read_files(std::span<const std::filesystem::path> paths,
+                             const ReadCallback& callback) {
+    if (!initialized_) {
+        SyncFileIO().read_files(paths, callback);
+        return;
+    }
+
+    std::vector<ReadSlot> slots(kSlotCount);
+
+    auto submit_read = [&](size_t slot_id) {
+        ReadSlot& slot = slots[slot_id];
+        io_uring_sqe* sqe = io_uring_get_sqe(ring_.get());
+        const auto remaining = static_cast<unsigned>(
+            std::min(slot.size - slot.done, kMaxTransfer));
+
+        if (slot.fixed) {
+            io_uring_prep_read_fixed(sqe, slot.fd, slot.data + slot.done, remaining,
+                                     slot.done, static_cast<int>(slot_id));
+        } else {
+            io_uring_prep_read(sqe, slot.fd, slot.data + slot.done, remaining, slot.done);
+        }
+        io_uring_sqe_set_data(sqe, &slot);
+    };
+
+    // Open the next file into a free slot; returns false if nothing was queued
+    size_t next = 0;
+    auto start_next = [&](size_t slot_id) -> bool {
+        while (next < paths.size()) {
+            const size_t index = next++;
+            ReadSlot& slot = slots[slot_id];
+
+            slot.fd = ::open(paths[index].c_str(), O_RDONLY | O_CLOEXEC);
+            if (slot.fd < 0) {
+                spdlog::error("Failed to open: {} ({})", paths[index], std::strerror(errno));
+                callback(index, {}, false);
+                continue;
+            }
+
+            struct stat st{};
+            if (::fstat(slot.fd, &st) != 0) {
+                spdlog::error("Failed to stat: {}", paths[index]);
+                close_fd(slot.fd);
+                callback(index, {}, false);
+                continue;
+            }
+
+            slot.index = index;
+            slot.size = static_cast<size_t>(st.st_size);
+            slot.done = 0;
+
+            if (slot.size == 0) {
+                close_fd(slot.fd);
+                callback(index, {}, true);
+                continue;
+            }
+
+            if (slot.size <= kSlotSize) {
+                slot.data = slots_[slot_id].get();
+                slot.fixed = fixed_buffers_;
+            } else {
+                slot.heap.resize(slot.size);
+                slot.data = slot.heap.data();
+                slot.fixed = false;
+            }
+
+            slot.busy = true;
+            submit_read(slot_id);
+            return true;
+        }
+        return false;
+    };
+
+    // Releases the window on every exit, including an exception thrown by
+    // the callback: handled CQEs are retired, and reads still owned by the
+    // kernel are cancelled and reaped before their fds and buffers go away
+    unsigned seen = 0;
+    struct ReadGuard {
+        UringFileIO& io;
+        std::vector<ReadSlot>& slots;
+        unsigned& seen;
+        bool released = false;
+
+        void release() {
+            if (released) return;
+            released = true;
+
+            if (seen > 0) {
+                io_uring_cq_advance(io.ring_.get(), seen);
+                seen = 0;
+            }
+            std::vector<void*> abandoned;
+            for (auto& slot : slots) {
+                if (slot.busy) abandoned.push_back(&slot);
+            }
+            io.abandon_in_flight(abandoned);
+            for (auto& slot : slots) {
+                close_fd(slot.fd);
+            }
+        }
+
+        ~ReadGuard() { release(); }
+    } guard{*this, slots, seen};
+
+    size_t in_flight = 0;
+    for (size_t s = 0; s < kSlotCount; ++s) {
+        if (start_next(s)) ++in_flight;
+    }
+
+    while (in_flight > 0) {
+        io_uring_submit(ring_.get());
+
+        io_uring_cqe* cqe = nullptr;
+        const int ret = io_uring_wait_cqe(ring_.get(), &cqe);
+        if (ret < 0) {
+            if (ret == -EINTR) continue;
+            spdlog::error("io_uring_wait_cqe failed: {}", std::strerror(-ret));
+            break;
+        }
+
+        // Drain every completion that is already available
+        unsigned head = 0;
+        io_uring_for_each_cqe(ring_.get(), head, cqe) {
+            ++seen;
+            auto* slot = static_cast<ReadSlot*>(io_uring_cqe_get_data(cqe));
+            const auto slot_id = static_cast<size_t>(slot - slots.data());
+            const int res = cqe->res;
+
+            if (res > 0 && slot->done + static_cast<size_t>(res) < slot->size) {
+                // Short read: continue from where it stopped
+                slot->done += static_cast<size_t>(res);
+                submit_read(slot_id);
+                continue;
+            }
+
+            // The kernel is done with this slot before the callback runs
+            close_fd(slot->fd);
+            slot->busy = false;
+            --in_flight;
+
+            const bool ok = res > 0 || (res == 0 && slot->done == slot->size);
+            if (ok) {
+                slot->done += static_cast<size_t>(res);
+                callback(slot->index, std::span<const uint8_t>(slot->data, slot->done), true);
+            } else {
+                spdlog::error("Failed to read: {} ({})", paths[slot->index],
+                              res < 0 ? std::strerror(-res) : "unexpected EOF");
+                callback(slot->index, {}, false);
+            }
+
+            slot->heap.clear();
+            slot->heap.shrink_to_fit();
+
+            if (start_next(slot_id)) ++in_flight;
+        }
+        io_uring_cq_advance(ring_.get(), seen);
+        seen = 0;
+    }
+
+    // Only leaves busy slots after a fatal ring error
+    guard.release();
+    for (auto& slot : slots) {
+        if (slot.busy) {
+            slot.busy = false;
+            callback(slot.index, {}, false);
+        }
+    }
+    while (next < paths.size()) {
+        callback(next++, {}, false);
+    }
+}
+
+// =============================================================================
+// Writes
+// =============================================================================
+
+std::vector<bool> UringFileIO::write_files(std::span<const FileWriteRequest> requests) {
+    if (!initialized_) {
+        return SyncFileIO().write_files(requests);
+    }
+
+    std::vector<bool> results(requests.size(), false);
+    std::vector<WriteOp> ops(requests.size());
+
+    auto submit_write = [&](size_t i) {
+        WriteOp& op = ops[i];
+        const auto& data = requests[i].data;
+        io_uring_sqe* sqe = io_uring_get_sqe(ring_.get());
+        io_uring_prep_write(sqe, op.fd, data.data() + op.done,
+                            static_cast<unsigned>(std::min(data.size() - op.done, kMaxTransfer)),
+                            op.done);
+        io_uring_sqe_set_data(sqe, &op);
+    };
+
+    // Submit in windows of kQueueDepth so the SQ never overflows
+    for (size_t base = 0; base < requests.size(); base += kQueueDepth) {
+        const size_t end = std::min(requests.size(), base + kQueueDepth);
+        size_t in_flight = 0;
+
+        for (size_t i = base; i < end; ++i) {
+            WriteOp& op = ops[i];
+            detach_hardlink(requests[i].path);
+            op.fd = ::open(requests[i].path.c_str(),
+                           O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (op.fd < 0) {
+                spdlog::error("Failed to open for writing: {} ({})",
+                              requests[i].path, std::strerror(errno));
+                continue;
+            }
+
+            if (requests[i].data.empty()) {
+                close_fd(op.fd);
+                results[i] = true;
+                continue;
+            }
+
+            op.busy = true;
+            submit_write(i);
+            ++in_flight;
+        }
+
+        while (in_flight > 0) {
+            io_uring_submit(ring_.get());
+
+            io_uring_cqe* cqe = nullptr;
+            const int ret = io_uring_wait_cqe(ring_.get(), &cqe);
+            if (ret < 0) {
+                if (ret == -EINTR) continue;
+                spdlog::error("io_uring_wait_cqe failed: {}", std::strerror(-ret));
+                break;
+            }
+
+            unsigned head = 0;
+            unsigned seen = 0;
+            io_uring_for_each_cqe(ring_.get(), head, cqe) {
+                ++seen;
+                auto* op = static_cast<WriteOp*>(io_uring_cqe_get_data(cqe));
+                const auto i = static_cast<size_t>(op - ops.data());
+                const int res = cqe->res;
+                const size_t total = requests[i].data.size();
+
+                if (res > 0 && op->done + static_cast<size_t>(res) < total) {
+                    // Short write: resubmit the remainder
+                    op->done += static_cast<size_t>(res);
+                    submit_write(i);
+                    continue;
+                }
+
+                results[i] = res > 0;
+                if (!results[i]) {
+                    spdlog::error("Failed to write: {} ({})", requests[i].path,
+                                  res < 0 ? std::strerror(-res) : "no progress");
+                }
+
+                close_fd(op->fd);
+                op->busy = false;
+                --in_flight;
+            }
+            io_uring_cq_advance(ring_.get(), seen);
+        }
+
+        // Only non-empty after a fatal ring error (see read_files)
+        std::vector<void*> abandoned;
+        for (size_t i = base; i < end; ++i) {
+            if (ops[i].busy) abandoned.push_back(&ops[i]);
+        }
+        abandon_in_flight(abandoned);
+
+        for (size_t i = base; i < end; ++i) {
+            if (ops[i].busy) {
+                close_fd(ops[i].fd);
+                ops[i].busy = false;
+            }
+        }
+
+        // The ring is gone: finish the remaining windows synchronously
+        if (!initialized_ && end < requests.size()) {
+            const auto rest = SyncFileIO().write_files(requests.subspan(end));
+            std::copy(rest.begin(), rest.end(), results.begin() + static_cast<std::ptrdiff_t>(end));
+            break;
+        }
+    }
+
+    return results;
+}
+
+}  // namespace gwt
@@ -0,0 +1,74 @@
+/**
+ * @file    uring_file_io.hpp
+ * @brief   io_uring File I/O Backend (Linux)
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Submits a window of whole-file reads/writes per io_uring_enter() call.
+ * Reads land in a small pool of registered (fixed) buffers that the batch
+ * pipeline decodes from directly; files larger than a pool slot fall back
+ * to heap buffers with regular reads.
+ *
+ * Only compiled when GWT_HAS_IO_URING is defined.
+ */
+
+#pragma once
+
+#include "core/file_io.hpp"
+
+#include <memory>
+#include <vector>
+
+struct io_uring;
+
+namespace gwt {
+
+class UringFileIO final : public IFileIO {
+public:
+    UringFileIO();
+    ~UringFileIO() override;
+
+    /**
+     * Create the ring and register the buffer pool
+     * @return false if io_uring is not usable (old kernel, seccomp, ...)
+     */
+    [[nodiscard]] bool init();
+
+    void read_files(std::span<const std::filesystem::path> paths,
+                    const ReadCallback& callback) override;
+
+    [[nodiscard]] std::vector<bool> write_files(
+        std::span<const FileWriteRequest> requests) override;
+
+    [[nodiscard]] std::string_view name() const noexcept override { return "io_uring"; }
+    [[nodiscard]] IoBackendType type() const noexcept override { return IoBackendType::IoUring; }
+
+    /**
+     * Runtime probe: ring creation and IORING_OP_READ/WRITE support
+     */
+    [[nodiscard]] static bool is_supported();
+
+    // Pool configuration
+    static constexpr unsigned kQueueDepth = 32;
+    static constexpr size_t kSlotCount = 8;
+    static constexpr size_t kSlotSize = 8 * 1024 * 1024;  // 8 MiB per slot
+
+private:
+    /**
+     * After a fatal wait error: cancel the given in-flight requests (by
+     * user data) and reap their completions, so no request still references
+     * an fd or buffer the caller is about to release. If that fails the
+     * ring is torn down and later calls use synchronous I/O.
+     */
+    void abandon_in_flight(const std::vector<void*>& requests);
+
+    void shutdown();
+
+    std::unique_ptr<io_uring> ring_;
+    bool initialized_ = false;
+    bool fixed_buffers_ = false;                 // Buffers registered with the ring
+    std::vector<std::unique_ptr<uint8_t[]>> slots_;
+};
+
+}  // namespace gwt
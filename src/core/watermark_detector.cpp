@@ -21,24 +21,20 @@
 #include <opencv2/imgproc.hpp>
 #include <spdlog/spdlog.h>
 #include <chrono>
-#include <memory>
 
 namespace gwt {
 
 namespace {
 
 // Lazy-initialized singleton WatermarkEngine for detection
-// This avoids repeatedly creating engines when detect_watermark_region is called
-std::unique_ptr<WatermarkEngine> g_detection_engine;
-
-WatermarkEngine& get_detection_engine() {
-    if (!g_detection_engine) {
-        g_detection_engine = std::make_unique<WatermarkEngine>(
-            embedded::bg_48_png, embedded::bg_48_png_size,
-            embedded::bg_96_png, embedded::bg_96_png_size
-        );
-    }
-    return *g_detection_engine;
+// This avoids repeatedly creating engines when detect_watermark_region is called;
+// a function-local static makes the first call safe from any thread
+const WatermarkEngine& get_detection_engine() {
+    static const WatermarkEngine engine(
+        embedded::bg_48_png, embedded::bg_48_png_size,
+        embedded::bg_96_png, embedded::bg_96_png_size
+    );
+    return engine;
 }
 
 }  // anonymous namespace
@@ -58,7 +54,7 @@ std::optional<DetectionResult> detect_watermark_region(
     spdlog::info("Watermark detection in {}x{} image", image.cols, image.rows);
 
     // Use WatermarkEngine's three-stage detection algorithm
-    WatermarkEngine& engine = get_detection_engine();
+    const WatermarkEngine& engine = get_detection_engine();
     DetectionResult result = engine.detect_watermark(image);
 
     auto end_time = std::chrono::high_resolution_clock::now();
@@ -83,4 +79,43 @@ cv::Rect get_fallback_watermark_region(int image_width, int image_height) {
     return cv::Rect(pos.x, pos.y, config.logo_size, config.logo_size);
 }
 
+ConfidenceMap compute_confidence_map(const cv::Mat& image, const cv::Rect& search,
+                                     const cv::Mat& alpha)
+{
+    ConfidenceMap map;
+    map.logo_size = alpha.size();
+    if (image.empty() || alpha.empty()) return map;
+
+    // Placements that keep the whole logo inside the image
+    const cv::Rect valid(0, 0, image.cols - alpha.cols + 1, image.rows - alpha.rows + 1);
+    if (valid.width <= 0 || valid.height <= 0) return map;
+
+    const cv::Rect placements = search & valid;
+    if (placements.empty()) return map;
+
+    // Pixels covered by any placement
+    const cv::Rect roi(placements.x, placements.y,
+                       placements.width + alpha.cols - 1, placements.height + alpha.rows - 1);
+
+    cv::Mat gray;
+    if (image.channels() >= 3) {
+        cv::cvtColor(image(roi), gray, image.channels() == 4 ? cv::COLOR_BGRA2GRAY : cv::COLOR_BGR2GRAY);
+    } else {
+        gray = image(roi);
+    }
+
+    cv::Mat gray_f;
+    gray.convertTo(gray_f, CV_32F, 1.0 / 255.0);
+
+    cv::matchTemplate(gray_f, alpha, map.scores, cv::TM_CCOEFF_NORMED);
+
+    // Flat areas divide by ~0 and come back as NaN/inf
+    cv::patchNaNs(map.scores, 0.0);
+    cv::min(map.scores, 1.0, map.scores);
+    cv::max(map.scores, -1.0, map.scores);
+
+    map.origin = placements.tl();
+    return map;
+}
+
 }  // namespace gwt
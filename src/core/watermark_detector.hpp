@@ -53,4 +53,39 @@ std::optional<DetectionResult> detect_watermark_region(
  */
 cv::Rect get_fallback_watermark_region(int image_width, int image_height);
 
+/**
+ * Spatial NCC scores for every placement of a watermark in a neighborhood
+ */
+struct ConfidenceMap {
+    cv::Point origin;       // Top-left of the placement scored by scores(0, 0)
+    cv::Size logo_size;     // Size of the scored watermark rect
+    cv::Mat scores;         // CV_32F in [-1, 1]; (y, x) = placement at origin + (x, y)
+
+    [[nodiscard]] bool empty() const noexcept { return scores.empty(); }
+
+    /**
+     * Placements (top-left positions) covered by the map
+     */
+    [[nodiscard]] cv::Rect placements() const noexcept {
+        return cv::Rect(origin, scores.size());
+    }
+};
+
+/**
+ * Dense version of detection stage 1 (spatial NCC with the alpha map)
+ *
+ * Only the pixels the candidate placements can cover are read. The
+ * correlation runs through cv::matchTemplate, whose normalization comes
+ * from integral images, so cost grows with the neighborhood rather than
+ * neighborhood x logo size.
+ *
+ * @param image      Input image (BGR or grayscale, 8-bit)
+ * @param search     Candidate top-left positions; clipped so every
+ *                   placement lies inside the image
+ * @param alpha      Alpha map at the logo size (WatermarkEngine::alpha_for_region)
+ * @return           Map, empty if no placement fits
+ */
+ConfidenceMap compute_confidence_map(const cv::Mat& image, const cv::Rect& search,
+                                     const cv::Mat& alpha);
+
 }  // namespace gwt
@@ -19,6 +19,9 @@
 #include <opencv2/imgproc.hpp>
 #include <spdlog/spdlog.h>
 #include <fmt/format.h>
+#include <algorithm>
+#include <functional>
+#include <future>
 #include <stdexcept>
 
 namespace gwt {
@@ -52,6 +55,31 @@ WatermarkSize get_watermark_size(int image_width, int image_height) {
     return WatermarkSize::Small;
 }
 
+cv::Rect get_watermark_region(int image_width, int image_height,
+                              std::optional<WatermarkSize> force_size) {
+    const WatermarkSize size = force_size.value_or(get_watermark_size(image_width, image_height));
+    const WatermarkPosition config = (size == WatermarkSize::Small)
+        ? WatermarkPosition{32, 32, 48}
+        : WatermarkPosition{64, 64, 96};
+
+    const cv::Point pos = config.get_position(image_width, image_height);
+    return cv::Rect(pos.x, pos.y, config.logo_size, config.logo_size);
+}
+
+cv::Rect get_detection_region(int image_width, int image_height,
+                              std::optional<WatermarkSize> force_size) {
+    // Mirrors detect_watermark(): position from the image size, alpha map
+    // from the (possibly forced) size, variance reference above the logo
+    const WatermarkSize size = force_size.value_or(get_watermark_size(image_width, image_height));
+    const int alpha_size = (size == WatermarkSize::Small) ? 48 : 96;
+    const WatermarkPosition config = get_watermark_config(image_width, image_height);
+    const cv::Point pos = config.get_position(image_width, image_height);
+
+    const cv::Rect region(pos.x, pos.y - config.logo_size,
+                          alpha_size, alpha_size + config.logo_size);
+    return region & cv::Rect(0, 0, image_width, image_height);
+}
+
 // Helper function to initialize alpha maps
 void WatermarkEngine::init_alpha_maps(const cv::Mat& bg_small, const cv::Mat& bg_large) {
     cv::Mat small_resized = bg_small;
@@ -222,6 +250,15 @@ const cv::Mat& WatermarkEngine::get_alpha_map(WatermarkSize size) const {
 DetectionResult WatermarkEngine::detect_watermark(
     const cv::Mat& image,
     std::optional<WatermarkSize> force_size) const
+{
+    return detect_watermark(image, image.size(), cv::Point(0, 0), force_size);
+}
+
+DetectionResult WatermarkEngine::detect_watermark(
+    const cv::Mat& image,
+    cv::Size image_size,
+    cv::Point origin,
+    std::optional<WatermarkSize> force_size) const
 {
     DetectionResult result{};
     result.detected = false;
@@ -234,14 +271,18 @@ DetectionResult WatermarkEngine::detect_watermark(
         return result;
     }
 
-    // Determine watermark size and position
-    const WatermarkSize size = force_size.value_or(get_watermark_size(image.cols, image.rows));
-    const WatermarkPosition config = get_watermark_config(image.cols, image.rows);
-    const cv::Point pos = config.get_position(image.cols, image.rows);
+    // Determine watermark size and position (image coordinates)
+    const WatermarkSize size = force_size.value_or(
+        get_watermark_size(image_size.width, image_size.height));
+    const WatermarkPosition config = get_watermark_config(image_size.width, image_size.height);
+    const cv::Point image_pos = config.get_position(image_size.width, image_size.height);
     const cv::Mat& alpha_map = get_alpha_map(size);
 
     result.size = size;
-    result.region = cv::Rect(pos.x, pos.y, alpha_map.cols, alpha_map.rows);
+    result.region = cv::Rect(image_pos.x, image_pos.y, alpha_map.cols, alpha_map.rows);
+
+    // From here on, coordinates are within the pixels we were given
+    const cv::Point pos = image_pos - origin;
 
     // Calculate ROI (clamp to image bounds)
     const int x1 = std::max(0, pos.x);
@@ -389,6 +430,45 @@ cv::Mat WatermarkEngine::create_interpolated_alpha(int target_width, int target_
     return interpolated;
 }
 
+cv::Mat WatermarkEngine::alpha_for_region(const cv::Size& size) {
+    if (size.width == 48 && size.height == 48) return alpha_map_small_;
+    if (size.width == 96 && size.height == 96) return alpha_map_large_;
+    return create_interpolated_alpha(size.width, size.height);
+}
+
+void WatermarkEngine::remove_watermark_region(
+    cv::Mat& patch,
+    cv::Point origin,
+    const cv::Rect& region)
+{
+    if (patch.empty()) {
+        throw std::runtime_error("Empty image provided");
+    }
+    if (patch.channels() != 3) {
+        throw std::runtime_error("Patch must be BGR");
+    }
+
+    // Alpha blending clips the region to the patch
+    const cv::Point pos(region.x - origin.x, region.y - origin.y);
+    remove_watermark_alpha_blend(patch, alpha_for_region(region.size()), pos, logo_value_);
+}
+
+void WatermarkEngine::add_watermark_region(
+    cv::Mat& patch,
+    cv::Point origin,
+    const cv::Rect& region)
+{
+    if (patch.empty()) {
+        throw std::runtime_error("Empty image provided");
+    }
+    if (patch.channels() != 3) {
+        throw std::runtime_error("Patch must be BGR");
+    }
+
+    const cv::Point pos(region.x - origin.x, region.y - origin.y);
+    add_watermark_alpha_blend(patch, alpha_for_region(region.size()), pos, logo_value_);
+}
+
 void WatermarkEngine::remove_watermark_custom(
     cv::Mat& image,
     const cv::Rect& region)
@@ -467,6 +547,94 @@ void WatermarkEngine::add_watermark_custom(
     add_watermark_alpha_blend(image, custom_alpha, pos, logo_value_);
 }
 
+ProcessResult process_loaded_image(
+    cv::Mat& image,
+    const std::filesystem::path& input_path,
+    bool remove,
+    WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    bool use_detection,
+    float detection_threshold) {
+
+    ProcessResult result{};
+    result.success = false;
+    result.skipped = false;
+    result.confidence = 0.0f;
+
+    spdlog::info("Processing: {} ({}x{})",
+                 input_path.filename(),
+                 image.cols, image.rows);
+
+    // Watermark detection (only for removal mode)
+    if (use_detection && remove) {
+        DetectionResult detection = engine.detect_watermark(image, force_size);
+        result.confidence = detection.confidence;
+
+        if (!detection.detected && detection.confidence < detection_threshold) {
+            result.skipped = true;
+            result.success = true;  // Not an error, just skipped
+            result.message = fmt::format("No watermark detected ({:.0f}%), skipped",
+                                         detection.confidence * 100.0f);
+            spdlog::info("{}: {} (spatial={:.2f}, grad={:.2f}, var={:.2f})",
+                         input_path.filename(), result.message,
+                         detection.spatial_score, detection.gradient_score,
+                         detection.variance_score);
+            return result;
+        }
+
+        spdlog::info("Watermark detected ({:.0f}% confidence), processing...",
+                     detection.confidence * 100.0f);
+    }
+
+    // Process image
+    if (remove) {
+        engine.remove_watermark(image, force_size);
+    } else {
+        engine.add_watermark(image, force_size);
+    }
+
+    result.success = true;
+    result.message = remove ? "Watermark removed" : "Watermark added";
+    return result;
+}
+
+size_t write_outputs(
+    const cv::Mat& image,
+    std::span<const OutputSpec> outputs,
+    const EncodeSource& source) {
+
+    const auto write_one = [&](const OutputSpec& spec) {
+        const cv::Mat frame = fit_to_max_dimension(image, spec.max_dimension);
+
+        if (write_image(frame, spec.path, spec.profile, source)) {
+            spdlog::info("Saved: {} ({}x{}, {})", spec.path.filename(),
+                         frame.cols, frame.rows, to_string(spec.profile));
+            return true;
+        }
+        spdlog::error("Failed to write image: {}", spec.path);
+        return false;
+    };
+
+    // Plain threads, not cv::parallel_for_: inside an OpenCV parallel region
+    // the PNG writer's own parallel_for_ would run serially
+    if (outputs.size() == 1) {
+        return write_one(outputs[0]) ? 0 : 1;
+    }
+
+    std::vector<std::future<bool>> pending;
+    pending.reserve(outputs.size());
+    for (size_t i = 1; i < outputs.size(); ++i) {
+        pending.push_back(std::async(std::launch::async, write_one, std::cref(outputs[i])));
+    }
+
+    size_t failed = 0;
+    if (!outputs.empty() && !write_one(outputs[0])) ++failed;
+    for (auto& result : pending) {
+        if (!result.get()) ++failed;
+    }
+    return failed;
+}
+
 ProcessResult process_image(
     const std::filesystem::path& input_path,
     const std::filesystem::path& output_path,
@@ -474,6 +642,21 @@ ProcessResult process_image(
     WatermarkEngine& engine,
     std::optional<WatermarkSize> force_size,
     bool use_detection,
+    float detection_threshold,
+    EncodeProfile profile) {
+
+    const OutputSpec output{output_path, profile, 0};
+    return process_image(input_path, std::span<const OutputSpec>(&output, 1), remove, engine,
+                         force_size, use_detection, detection_threshold);
+}
+
+ProcessResult process_image(
+    const std::filesystem::path& input_path,
+    std::span<const OutputSpec> outputs,
+    bool remove,
+    WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size,
+    bool use_detection,
     float detection_threshold) {
 
     ProcessResult result{};
@@ -490,71 +673,32 @@ ProcessResult process_image(
             return result;
         }
 
-        spdlog::info("Processing: {} ({}x{})",
-                     input_path.filename(),
-                     image.cols, image.rows);
-
-        // Watermark detection (only for removal mode)
-        if (use_detection && remove) {
-            DetectionResult detection = engine.detect_watermark(image, force_size);
-            result.confidence = detection.confidence;
-
-            if (!detection.detected && detection.confidence < detection_threshold) {
-                result.skipped = true;
-                result.success = true;  // Not an error, just skipped
-                result.message = fmt::format("No watermark detected ({:.0f}%), skipped",
-                                             detection.confidence * 100.0f);
-                spdlog::info("{}: {} (spatial={:.2f}, grad={:.2f}, var={:.2f})",
-                             input_path.filename(), result.message,
-                             detection.spatial_score, detection.gradient_score,
-                             detection.variance_score);
-                return result;
-            }
-
-            spdlog::info("Watermark detected ({:.0f}% confidence), processing...",
-                         detection.confidence * 100.0f);
-        }
-
-        // Process image
-        if (remove) {
-            engine.remove_watermark(image, force_size);
-        } else {
-            engine.add_watermark(image, force_size);
-        }
-
-        // Create output directory if needed
-        auto output_dir = output_path.parent_path();
-        if (!output_dir.empty() && !std::filesystem::exists(output_dir)) {
-            std::filesystem::create_directories(output_dir);
-        }
-
-        // Determine output format and quality
-        std::vector<int> params;
-        std::string ext = output_path.extension().string();
-        std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-
-        if (ext == ".jpg" || ext == ".jpeg") {
-            params = {cv::IMWRITE_JPEG_QUALITY, 100};
-        } else if (ext == ".png") {
-            params = {cv::IMWRITE_PNG_COMPRESSION, 6};
-        } else if (ext == ".webp") {
-            params = {cv::IMWRITE_WEBP_QUALITY, 101};
+        result = process_loaded_image(image, input_path, remove, engine,
+                                      force_size, use_detection, detection_threshold);
+        if (!result.success || result.skipped) {
+            return result;
         }
 
-        // Write output
-        bool write_success = cv::imwrite(output_path.string(), image, params);
-        if (!write_success) {
-            result.message = "Failed to write image";
-            spdlog::error("Failed to write image: {}", output_path);
+        // Probe the source encoding once if any output mirrors it
+        const bool match_input = std::any_of(outputs.begin(), outputs.end(),
+            [](const OutputSpec& spec) { return spec.profile == EncodeProfile::MatchInput; });
+        const EncodeSource source = match_input ? probe_encode_source(input_path)
+                                                : EncodeSource{};
+
+        // Write outputs (creates output directories if needed)
+        const size_t failed = write_outputs(image, outputs, source);
+        if (failed > 0) {
+            result.success = false;
+            result.message = (outputs.size() == 1)
+                ? std::string("Failed to write image")
+                : fmt::format("Failed to write {} of {} outputs", failed, outputs.size());
             return result;
         }
 
-        result.success = true;
-        result.message = remove ? "Watermark removed" : "Watermark added";
-        spdlog::info("Saved: {}", output_path.filename());
         return result;
 
     } catch (const std::exception& e) {
+        result.success = false;
         result.message = std::string("Error: ") + e.what();
         spdlog::error("Error processing {}: {}", input_path, e.what());
         return result;
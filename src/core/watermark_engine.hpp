@@ -1,9 +1,14 @@
 #pragma once
 
+#include "core/image_codec.hpp"
+
 #include <opencv2/core.hpp>
+#include <cstdint>
 #include <string>
 #include <optional>
 #include <filesystem>
+#include <span>
+#include <vector>
 
 namespace gwt {
 
@@ -61,6 +66,25 @@ WatermarkPosition get_watermark_config(int image_width, int image_height);
  */
 WatermarkSize get_watermark_size(int image_width, int image_height);
 
+/**
+ * Region covered by the standard watermark (as placed by remove_watermark)
+ *
+ * @param force_size  Size to use (derived from the dimensions if nullopt)
+ * @return            Logo rectangle; may extend past a very small image
+ */
+cv::Rect get_watermark_region(int image_width, int image_height,
+                              std::optional<WatermarkSize> force_size = std::nullopt);
+
+/**
+ * Region detect_watermark() reads: the logo area plus the reference rows
+ * above it, clipped to the image
+ *
+ * Decoding just this region is enough to run detection (see the region
+ * overload of WatermarkEngine::detect_watermark).
+ */
+cv::Rect get_detection_region(int image_width, int image_height,
+                              std::optional<WatermarkSize> force_size = std::nullopt);
+
 /**
  * Main watermark engine class
  *
@@ -121,6 +145,25 @@ public:
         std::optional<WatermarkSize> force_size = std::nullopt
     ) const;
 
+    /**
+     * Detect watermark from a decoded part of an image
+     *
+     * Gives the same result as the whole-image overload as long as region
+     * covers get_detection_region() of the image.
+     *
+     * @param region      Pixels of part of the image
+     * @param image_size  Size of the whole image
+     * @param origin      Top-left of region within the image
+     * @param force_size  Force a specific watermark size (auto-detect if nullopt)
+     * @return            Detection result (region in image coordinates)
+     */
+    DetectionResult detect_watermark(
+        const cv::Mat& region,
+        cv::Size image_size,
+        cv::Point origin,
+        std::optional<WatermarkSize> force_size = std::nullopt
+    ) const;
+
     /**
      * Remove watermark from an image
      *
@@ -165,6 +208,39 @@ public:
         const cv::Rect& region
     );
 
+    /**
+     * Remove the watermark from a patch cut out of a larger image
+     *
+     * Only pixels under the watermark change, so callers can process a copy
+     * of image(patch_rect) instead of a clone of the whole frame. 48x48 and
+     * 96x96 regions use the captured alpha maps, other sizes interpolate.
+     *
+     * @param patch   Pixels of the image at origin (BGR, modified in-place)
+     * @param origin  Top-left of the patch in image coordinates
+     * @param region  Watermark region in image coordinates
+     */
+    void remove_watermark_region(
+        cv::Mat& patch,
+        cv::Point origin,
+        const cv::Rect& region
+    );
+
+    /**
+     * Add the watermark to a patch cut out of a larger image
+     * (see remove_watermark_region)
+     */
+    void add_watermark_region(
+        cv::Mat& patch,
+        cv::Point origin,
+        const cv::Rect& region
+    );
+
+    /**
+     * Alpha map for a region: the captured map for 48x48 / 96x96,
+     * otherwise an interpolated one
+     */
+    cv::Mat alpha_for_region(const cv::Size& size);
+
     /**
      * Get the alpha map for a specific size (for external use)
      */
@@ -211,6 +287,7 @@ struct ProcessResult {
  * @param force_size   Force a specific watermark size (auto-detect if nullopt)
  * @param use_detection  Enable watermark detection before processing
  * @param detection_threshold  Confidence threshold for detection (default: 0.25)
+ * @param profile      Output encode profile (default: Max)
  * @return             Processing result
  */
 ProcessResult process_image(
@@ -220,6 +297,75 @@ ProcessResult process_image(
     WatermarkEngine& engine,
     std::optional<WatermarkSize> force_size = std::nullopt,
     bool use_detection = false,
+    float detection_threshold = 0.25f,
+    EncodeProfile profile = EncodeProfile::Max
+);
+
+/**
+ * Process a single image file into several outputs
+ *
+ * The input is decoded and processed once; every output (format, profile,
+ * optional downscale) is then encoded from the same frame in parallel.
+ *
+ * @param input_path   Input image path
+ * @param outputs      Outputs to produce
+ * @param remove       Remove watermark (true) or add watermark (false)
+ * @param engine       The watermark engine to use
+ * @param force_size   Force a specific watermark size (auto-detect if nullopt)
+ * @param use_detection  Enable watermark detection before processing
+ * @param detection_threshold  Confidence threshold for detection (default: 0.25)
+ * @return             Processing result (fails if any output fails)
+ */
+ProcessResult process_image(
+    const std::filesystem::path& input_path,
+    std::span<const OutputSpec> outputs,
+    bool remove,
+    WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt,
+    bool use_detection = false,
+    float detection_threshold = 0.25f
+);
+
+/**
+ * Encode one frame into several outputs in parallel
+ *
+ * A single output is written on the calling thread; extra outputs get a
+ * thread each. OpenCV's parallel_for_ is deliberately not used here, so the
+ * PNG writer keeps its own parallelism.
+ *
+ * @param image    Processed frame
+ * @param outputs  Outputs to produce
+ * @param source   Input encoding (for MatchInput outputs)
+ * @return         Number of outputs that failed
+ */
+size_t write_outputs(
+    const cv::Mat& image,
+    std::span<const OutputSpec> outputs,
+    const EncodeSource& source = {}
+);
+
+/**
+ * Run detection and the watermark operation on an already decoded image
+ *
+ * This is the decode/encode-free core of process_image(), used by pipelines
+ * that read and write file contents themselves (see core/batch_pipeline.hpp).
+ *
+ * @param image        Decoded image (modified in-place unless skipped)
+ * @param input_path   Input path (used for logging only)
+ * @param remove       Remove watermark (true) or add watermark (false)
+ * @param engine       The watermark engine to use
+ * @param force_size   Force a specific watermark size (auto-detect if nullopt)
+ * @param use_detection  Enable watermark detection before processing
+ * @param detection_threshold  Confidence threshold for detection
+ * @return             Processing result (success && !skipped: image was modified)
+ */
+ProcessResult process_loaded_image(
+    cv::Mat& image,
+    const std::filesystem::path& input_path,
+    bool remove,
+    WatermarkEngine& engine,
+    std::optional<WatermarkSize> force_size = std::nullopt,
+    bool use_detection = false,
     float detection_threshold = 0.25f
 );
 
@@ -6,6 +6,8 @@
  */
 
 #include "gui/app/app_controller.hpp"
+#include "gui/app/thumbnail_loader.hpp"
+#include "gui/backend/texture_upload.hpp"
 #include "core/watermark_detector.hpp"
 #include "embedded_assets.hpp"
 #include "utils/path_formatter.hpp"
@@ -16,9 +18,144 @@
 #include <fmt/core.h>
 
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
 
 namespace gwt::gui {
 
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+float elapsed_ms(Clock::time_point start) {
+    return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+}
+
+/**
+ * One batch grid cell (RGBA, kThumbnailCellSize square) with the BGR
+ * thumbnail centered above the label area
+ */
+cv::Mat compose_thumbnail_cell(const cv::Mat& thumb) {
+    using namespace batch_theme;
+
+    const int cell_size = kThumbnailCellSize;
+    const int pad       = kCellPadding;
+    const int avail_h   = cell_size - kLabelHeight - pad * 2;
+
+    cv::Mat cell(cell_size, cell_size, CV_8UC4,
+                 cv::Scalar(kAtlasBgR, kAtlasBgG, kAtlasBgB, kAtlasBgA));
+    cv::rectangle(cell, cv::Rect(pad, pad, cell_size - pad * 2, cell_size - pad * 2),
+        cv::Scalar(kCellBgR, kCellBgG, kCellBgB, kCellBgA), cv::FILLED);
+
+    // Center image within cell
+    const cv::Rect roi = cv::Rect((cell_size - thumb.cols) / 2,
+                                  pad + (avail_h - thumb.rows) / 2,
+                                  thumb.cols, thumb.rows)
+                       & cv::Rect(0, 0, cell_size, cell_size);
+    if (roi.empty()) return cell;
+
+    cv::Mat rgba;
+    cv::cvtColor(thumb, rgba, cv::COLOR_BGR2RGBA);
+    rgba(cv::Rect(0, 0, roi.width, roi.height)).copyTo(cell(roi));
+
+    // Thin border
+    cv::rectangle(cell, roi,
+        cv::Scalar(kCellBorderR, kCellBorderG, kCellBorderB, kCellBorderA), 1);
+
+    return cell;
+}
+
+/**
+ * Bounding box of the pixels that differ between two same-sized images
+ * (empty if identical)
+ */
+cv::Rect changed_bounds(const cv::Mat& a, const cv::Mat& b) {
+    if (a.size() != b.size() || a.type() != b.type()) {
+        return cv::Rect(0, 0, b.cols, b.rows);
+    }
+
+    const size_t pixel_bytes = a.elemSize();
+    const size_t row_bytes = static_cast<size_t>(a.cols) * pixel_bytes;
+
+    int top = -1, bottom = -1;
+    for (int y = 0; y < a.rows; ++y) {
+        if (std::memcmp(a.ptr(y), b.ptr(y), row_bytes) != 0) {
+            if (top < 0) top = y;
+            bottom = y;
+        }
+    }
+    if (top < 0) return {};
+
+    int left = a.cols, right = -1;
+    for (int y = top; y <= bottom; ++y) {
+        const uint8_t* pa = a.ptr(y);
+        const uint8_t* pb = b.ptr(y);
+        for (int x = 0; x < left; ++x) {
+            if (std::memcmp(pa + x * pixel_bytes, pb + x * pixel_bytes, pixel_bytes) != 0) {
+                left = x;
+                break;
+            }
+        }
+        for (int x = a.cols - 1; x > right; --x) {
+            if (std::memcmp(pa + x * pixel_bytes, pb + x * pixel_bytes, pixel_bytes) != 0) {
+                right = x;
+                break;
+            }
+        }
+    }
+
+    return cv::Rect(left, top, right - left + 1, bottom - top + 1);
+}
+
+/**
+ * Remove/add the watermark at region, touching only a copy of the pixels
+ * under it; the result is cropped to what actually changed
+ */
+ImagePatch process_region(WatermarkEngine& engine, const cv::Mat& original,
+                          const cv::Rect& region, bool remove) {
+    const cv::Rect roi = region & cv::Rect(0, 0, original.cols, original.rows);
+    if (roi.empty()) {
+        throw std::runtime_error("Watermark region is outside the image");
+    }
+    cv::Mat pixels = original(roi).clone();
+
+    if (remove) {
+        engine.remove_watermark_region(pixels, roi.tl(), region);
+    } else {
+        engine.add_watermark_region(pixels, roi.tl(), region);
+    }
+
+    // The alpha map fades out towards its edges
+    const cv::Rect changed = changed_bounds(original(roi), pixels);
+    if (changed.empty()) return ImagePatch{roi, std::move(pixels)};
+    return ImagePatch{changed + roi.tl(), pixels(changed).clone()};
+}
+
+/**
+ * Half-width of the placement neighborhood scored around the custom rect
+ */
+int confidence_radius(const cv::Size& logo_size) {
+    return std::clamp(std::max(logo_size.width, logo_size.height) / 2, 16, 128);
+}
+
+constexpr int kSnapRadius = 6;              // Peak search window around the released rect
+constexpr float kSnapMinScore = 0.25f;      // Weaker peaks are noise (detection stage 1 threshold)
+constexpr double kHeatMapOpacity = 0.7;     // Alpha of a perfect match
+
+/**
+ * Overlay texture dimension for a patch: rounded up, so a patch that grows
+ * a little (live custom-region drag) reuses the texture
+ */
+uint32_t overlay_capacity(int size) {
+    constexpr int kGranularity = 64;
+    return static_cast<uint32_t>((size + kGranularity - 1) / kGranularity * kGranularity);
+}
+
+}  // anonymous namespace
+
 // =============================================================================
 // Construction / Destruction
 // =============================================================================
@@ -32,14 +169,30 @@ AppController::AppController(IRenderBackend& backend)
         embedded::bg_96_png, embedded::bg_96_png_size
     );
 
-    spdlog::debug("AppController initialized");
+    m_preview_tiles = std::make_unique<TiledTexture>(m_backend);
+    m_workers = std::make_unique<WorkerPool>();
+    m_task_workers = std::make_unique<WorkerPool>(2);
+    m_prefetch = std::make_unique<PrefetchCache>();
+
+    // Persistent thumbnail cache; trim it off the UI thread
+    m_thumb_cache = std::make_unique<ThumbnailCache>(ThumbnailCache::default_directory());
+    if (m_thumb_cache->enabled()) {
+        m_workers->submit([this] { m_thumb_cache->evict(); });
+    }
+
+    spdlog::debug("AppController initialized ({} worker threads)", m_workers->thread_count());
 }
 
 AppController::~AppController() {
+    // Stop workers first: running jobs finish, queued jobs are dropped
+    m_shutting_down = true;
+    m_batch_cancel = true;
+    ++m_task_generation;
+    m_task_workers.reset();
+    m_workers.reset();
+
     // Destroy textures
-    if (m_state.preview_texture.valid()) {
-        m_backend.destroy_texture(m_state.preview_texture);
-    }
+    destroy_preview_textures();
     if (m_state.batch.thumbnail_texture.valid()) {
         m_backend.destroy_texture(m_state.batch.thumbnail_texture);
     }
@@ -52,49 +205,46 @@ AppController::~AppController() {
 bool AppController::load_image(const std::filesystem::path& path) {
     spdlog::info("Loading image: {}", path);
 
-    // Read image first to validate
-    cv::Mat image = cv::imread(path.string(), cv::IMREAD_COLOR);
-    if (image.empty()) {
-        m_state.state = ProcessState::Error;
-        m_state.error_message = "Failed to load image: " + to_utf8(path);
-        m_state.status_message = "Load failed";
-        spdlog::error("{}", m_state.error_message);
-        return false;
-    }
-
-    // Clean up old state completely (including texture)
-    if (m_state.preview_texture.valid()) {
-        m_backend.destroy_texture(m_state.preview_texture);
-        m_state.preview_texture = TextureHandle{};
-    }
-    m_state.reset();
-
-    // Update state with new image
-    m_state.image.file_path = path;
-    m_state.image.original = image;
-    m_state.image.width = image.cols;
-    m_state.image.height = image.rows;
-    m_state.image.channels = image.channels();
+    const uint64_t generation = begin_async_task();
+    const bool run_detection = (m_state.process_options.size_mode == WatermarkSizeMode::Custom);
 
+    // Already decoded by folder prefetch: show it this frame
+    if (apply_prefetched_image(path, generation, run_detection)) return true;
 
-    // Run auto-detection when entering custom mode
-    if (m_state.process_options.size_mode == WatermarkSizeMode::Custom && m_state.image.has_image()) {
-        detect_custom_watermark();
-    }
-
-    // Detect watermark info
-    update_watermark_info();
+    m_state.state = ProcessState::Loading;
+    m_state.status_message = "Loading: " + filename_utf8(path);
+    m_state.error_message.clear();
 
-    // Update display
-    update_display_image();
+    m_task_workers->submit([this, generation, path, run_detection] {
+        const auto start = Clock::now();
+        AsyncResult result;
+        result.generation = generation;
+        result.path = path;
+
+        if (!is_current_task(generation)) return;
+        cv::Mat image = cv::imread(path.string(), cv::IMREAD_COLOR);
+        if (image.empty()) {
+            result.error = "Failed to load image: " + to_utf8(path);
+            post_async_result(std::move(result));
+            return;
+        }
+        m_task_progress = 0.6f;
 
-    // Update state
-    m_state.state = ProcessState::Loaded;
-    m_state.status_message = fmt::format("Loaded: {}x{}", image.cols, image.rows);
-    m_state.error_message.clear();
+        // Run auto-detection when entering custom mode
+        if (run_detection) {
+            if (!is_current_task(generation)) return;
+            result.detection = m_engine->detect_watermark(image);
+            result.detection_run = true;
+        }
+        m_task_progress = 0.8f;
 
-    spdlog::info("Image loaded: {}x{} ({} channels)",
-                 image.cols, image.rows, image.channels());
+        if (!is_current_task(generation)) return;
+        result.pyramid = TiledTexture::build_pyramid(image);
+        result.image = std::move(image);
+        result.kind = AsyncResult::Kind::Loaded;
+        result.elapsed_ms = elapsed_ms(start);
+        post_async_result(std::move(result));
+    });
 
     return true;
 }
@@ -107,29 +257,25 @@ bool AppController::save_image(const std::filesystem::path& path) {
 
     spdlog::info("Saving image: {}", path);
 
-    // Determine output format and quality
-    std::vector<int> params;
-    std::string ext = path.extension().string();
-    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-
-    if (ext == ".jpg" || ext == ".jpeg") {
-        params = {cv::IMWRITE_JPEG_QUALITY, 100};
-    } else if (ext == ".png") {
-        params = {cv::IMWRITE_PNG_COMPRESSION, 6};
-    } else if (ext == ".webp") {
-        params = {cv::IMWRITE_WEBP_QUALITY, 101};  // Lossless
-    }
-
-    // Create output directory if needed
-    auto output_dir = path.parent_path();
-    if (!output_dir.empty() && !std::filesystem::exists(output_dir)) {
-        std::filesystem::create_directories(output_dir);
-    }
+    // Match-input mirrors the encoding of the loaded file
+    const EncodeProfile profile = m_state.process_options.encode_profile;
+    const EncodeSource source = (profile == EncodeProfile::MatchInput && m_state.image.file_path)
+        ? probe_encode_source(*m_state.image.file_path)
+        : EncodeSource{};
 
-    // Write currently displayed image (WYSIWYG - What You See Is What You Get)
-    bool success = cv::imwrite(path.string(), m_state.image.display, params);
+    // Write currently displayed image (WYSIWYG - What You See Is What You Get);
+    // this is the only place the full processed frame is materialized
+    const auto& image = m_state.image;
+    const bool processed = m_state.preview_options.show_processed && image.has_processed();
+    const cv::Mat frame = processed ? image.processed.apply(image.original) : image.original;
+    bool success = write_image(frame, path, profile, source);
 
     if (success) {
+        m_thumb_cache->invalidate(path);
+        m_prefetch->erase(path);
+        if (m_state.image.file_path && path.parent_path() == m_folder) {
+            update_folder(*m_state.image.file_path, true);  // May be a new file
+        }
         m_state.status_message = "Saved: " + filename_utf8(path);
         spdlog::info("Image saved: {}", path);
     } else {
@@ -142,13 +288,17 @@ bool AppController::save_image(const std::filesystem::path& path) {
 }
 
 void AppController::close_image() {
+    // Drop any in-flight load/process result
+    ++m_task_generation;
+
     // Destroy texture
-    if (m_state.preview_texture.valid()) {
-        m_backend.destroy_texture(m_state.preview_texture);
-        m_state.preview_texture = TextureHandle{};
-    }
+    destroy_preview_textures();
 
     m_state.reset();
+    m_history.clear();
+    m_live_active = false;
+    reset_confidence_map();
+    cancel_prefetch();
     spdlog::debug("Image closed");
 }
 
@@ -162,62 +312,98 @@ void AppController::process_current() {
         return;
     }
 
+    const uint64_t generation = begin_async_task();
+
     m_state.state = ProcessState::Processing;
     m_state.status_message = "Processing...";
 
-    try {
-        // Clone original for processing
-        m_state.image.processed = m_state.image.original.clone();
-
-        bool is_custom = (m_state.process_options.size_mode == WatermarkSizeMode::Custom) &&
-                         m_state.custom_watermark.has_region;
-
-        // Apply watermark operation
-        if (m_state.process_options.remove_mode) {
-            if (is_custom) {
-                m_engine->remove_watermark_custom(
-                    m_state.image.processed,
-                    m_state.custom_watermark.region
-                );
-                spdlog::info("Watermark removed (custom region)");
-            } else {
-                m_engine->remove_watermark(
-                    m_state.image.processed,
-                    m_state.process_options.force_size
-                );
-                spdlog::info("Watermark removed");
-            }
-        } else {
-            if (is_custom) {
-                m_engine->add_watermark_custom(
-                    m_state.image.processed,
-                    m_state.custom_watermark.region
-                );
-                spdlog::info("Watermark added (custom region)");
-            } else {
-                m_engine->add_watermark(
-                    m_state.image.processed,
-                    m_state.process_options.force_size
-                );
-                spdlog::info("Watermark added");
-            }
+    // Snapshot inputs: the original is shared (never modified), options copied
+    const bool is_custom = (m_state.process_options.size_mode == WatermarkSizeMode::Custom) &&
+                           m_state.custom_watermark.has_region;
+    const cv::Rect region = is_custom
+        ? m_state.custom_watermark.region
+        : get_watermark_region(m_state.image.width, m_state.image.height,
+                               m_state.process_options.force_size);
+    const EditParams params = current_edit_params();
+
+    m_task_workers->submit([this, generation,
+                            original = m_state.image.original,
+                            path = m_state.image.file_path.value_or(std::filesystem::path{}),
+                            remove = m_state.process_options.remove_mode,
+                            region, is_custom, params] {
+        const auto start = Clock::now();
+        AsyncResult result;
+        result.generation = generation;
+        result.path = path;
+        result.params = params;
+
+        if (!is_current_task(generation)) return;
+
+        try {
+            // Only the watermark box changes: process a copy of just that
+            result.patch = process_region(*m_engine, original, region, remove);
+            spdlog::info("Watermark {}{}", remove ? "removed" : "added",
+                         is_custom ? " (custom region)" : "");
+            m_task_progress = 0.8f;
+
+            if (!is_current_task(generation)) return;
+            result.kind = AsyncResult::Kind::Processed;
+        } catch (const std::exception& e) {
+            result.kind = AsyncResult::Kind::Failed;
+            result.error = e.what();
         }
 
-        // Show processed result
-        m_state.preview_options.show_processed = true;
-        update_display_image();
+        result.elapsed_ms = elapsed_ms(start);
+        post_async_result(std::move(result));
+    });
+}
 
-        m_state.state = ProcessState::Completed;
-        m_state.status_message = m_state.process_options.remove_mode
-            ? "Watermark removed"
-            : "Watermark added";
-        m_state.error_message.clear();
+void AppController::poll_async_tasks() {
+    // Before draining anything, so results posted from now on wake us again
+    m_wake_pending.store(false, std::memory_order_release);
 
-    } catch (const std::exception& e) {
-        m_state.state = ProcessState::Error;
-        m_state.error_message = e.what();
-        m_state.status_message = "Processing failed";
-        spdlog::error("Processing failed: {}", e.what());
+    std::optional<AsyncResult> result;
+    {
+        std::lock_guard lock(m_async_mutex);
+        result.swap(m_async_result);
+    }
+
+    if (!result) {
+        if (m_state.is_busy()) {
+            m_state.task_progress = m_task_progress.load(std::memory_order_relaxed);
+        }
+        return;
+    }
+
+    // Superseded while waiting in the mailbox
+    if (!is_current_task(result->generation)) return;
+
+    m_state.task_progress = 1.0f;
+
+    switch (result->kind) {
+        case AsyncResult::Kind::Loaded:
+            m_perf.decode_ms.add(perf_time(), result->elapsed_ms);
+            apply_loaded_image(*result);
+            break;
+        case AsyncResult::Kind::Processed:
+            m_perf.process_ms.add(perf_time(), result->elapsed_ms);
+            apply_processed_image(*result);
+            break;
+        case AsyncResult::Kind::Failed:
+        default:
+            if (m_state.state == ProcessState::Loading) {
+                // Keep whatever was on screen before the failed load
+                m_state.state = m_state.image.has_image()
+                    ? (m_state.image.has_processed() ? ProcessState::Completed : ProcessState::Loaded)
+                    : ProcessState::Error;
+                m_state.status_message = "Load failed";
+            } else {
+                m_state.state = ProcessState::Error;
+                m_state.status_message = "Processing failed";
+            }
+            m_state.error_message = result->error;
+            spdlog::error("{}", result->error);
+            break;
     }
 }
 
@@ -225,11 +411,276 @@ void AppController::revert_to_original() {
     if (!m_state.image.has_image()) return;
 
     m_state.preview_options.show_processed = false;
-    update_display_image();
 
     m_state.status_message = "Reverted to original";
 }
 
+void AppController::update_live_preview() {
+    const auto& cw = m_state.custom_watermark;
+
+    if (!cw.is_drawing && !cw.is_resizing) {
+        if (!m_live_active) return;
+        // The rect may have snapped on release
+        if (cw.region != m_live_region) refresh_live_patch();
+        commit_live_preview();
+        return;
+    }
+
+    if (m_state.is_busy() || !m_state.image.has_image() || !cw.has_region ||
+        m_state.process_options.size_mode != WatermarkSizeMode::Custom) {
+        return;
+    }
+
+    // At most once per frame, and only when the rect moved since the
+    // result on screen was made
+    const cv::Rect shown = m_live_active
+        ? m_live_region
+        : (m_state.image.has_processed() ? m_applied_params.custom_region.value_or(cv::Rect())
+                                         : cv::Rect());
+    if (cw.region == shown) return;
+
+    refresh_live_patch();
+}
+
+void AppController::refresh_live_patch() {
+    const auto& cw = m_state.custom_watermark;
+
+    ImagePatch patch;
+    try {
+        patch = process_region(*m_engine, m_state.image.original, cw.region,
+                               m_state.process_options.remove_mode);
+    } catch (const std::exception& e) {
+        spdlog::debug("Live preview: {}", e.what());
+        return;
+    }
+
+    if (!m_live_active) {
+        m_live_before = EditSnapshot{m_state.image.processed, m_applied_params};
+        m_live_active = true;
+    }
+    m_live_region = cw.region;
+
+    // The previous patch is simply no longer drawn, so only the new
+    // region is processed and uploaded
+    m_state.image.processed = std::move(patch);
+    update_overlay_texture();
+    m_state.preview_options.show_processed = true;
+}
+
+// =============================================================================
+// Confidence Map
+// =============================================================================
+
+void AppController::update_confidence_map() {
+    const auto& cw = m_state.custom_watermark;
+    const bool enabled = m_state.preview_options.show_confidence_map &&
+                         m_state.image.has_image() && !m_state.batch.is_batch_mode() &&
+                         m_state.process_options.size_mode == WatermarkSizeMode::Custom &&
+                         cw.has_region;
+    if (!enabled) {
+        if (m_confidence_pending || !m_confidence.empty()) reset_confidence_map();
+        return;
+    }
+
+    // Pick up a finished map
+    std::optional<ConfidenceResult> result;
+    {
+        std::lock_guard lock(m_async_mutex);
+        result.swap(m_confidence_result);
+    }
+    if (result && result->generation == m_confidence_generation.load(std::memory_order_acquire)) {
+        m_confidence_pending = false;
+        m_confidence = std::move(result->map);
+        upload_confidence_texture();
+    }
+
+    // Drag released: settle on the nearest peak
+    const bool dragging = cw.is_drawing || cw.is_resizing;
+    if (m_confidence_dragging && !dragging) {
+        snap_to_confidence_peak();
+    }
+    m_confidence_dragging = dragging;
+
+    // One job at a time; the next starts from wherever the rect is by then
+    if (m_confidence_pending) return;
+
+    const cv::Rect& region = cw.region;
+    const int margin = confidence_radius(region.size()) / 2;
+    const bool covered = m_confidence_request.size() == region.size() &&
+                         std::abs(region.x - m_confidence_request.x) <= margin &&
+                         std::abs(region.y - m_confidence_request.y) <= margin;
+    if (!covered) {
+        request_confidence_map();
+    }
+}
+
+void AppController::request_confidence_map() {
+    const cv::Rect region = m_state.custom_watermark.region;
+
+    // Templates are rebuilt only when the rect size changes
+    if (m_confidence_template.size() != region.size()) {
+        m_confidence_template = m_engine->alpha_for_region(region.size());
+    }
+
+    const int radius = confidence_radius(region.size());
+    const cv::Rect search(region.x - radius, region.y - radius, 2 * radius + 1, 2 * radius + 1);
+    const uint64_t generation = m_confidence_generation.load(std::memory_order_acquire);
+
+    m_confidence_request = region;
+    m_confidence_pending = true;
+
+    m_task_workers->submit([this, generation, search,
+                            original = m_state.image.original,
+                            alpha = m_confidence_template] {
+        if (m_confidence_generation.load(std::memory_order_acquire) != generation) return;
+
+        const auto start = Clock::now();
+        ConfidenceResult result;
+        result.generation = generation;
+        // An empty map is still posted on failure so the request stops pending
+        try {
+            result.map = compute_confidence_map(original, search, alpha);
+            spdlog::debug("Confidence map: {}x{} placements in {:.2f} ms",
+                          result.map.scores.cols, result.map.scores.rows, elapsed_ms(start));
+        } catch (const std::exception& e) {
+            result.map = ConfidenceMap{};
+            spdlog::warn("Confidence map failed: {}", e.what());
+        }
+
+        {
+            std::lock_guard lock(m_async_mutex);
+            if (m_confidence_generation.load(std::memory_order_acquire) != generation) return;
+            m_confidence_result = std::move(result);
+        }
+        wake_ui();
+    });
+}
+
+void AppController::upload_confidence_texture() {
+    if (m_confidence.empty()) {
+        if (m_state.confidence_texture.valid()) {
+            m_backend.destroy_texture(m_state.confidence_texture);
+            m_state.confidence_texture = TextureHandle{};
+        }
+        return;
+    }
+
+    // Heat colors, fading out towards zero correlation (negatives saturate to 0)
+    cv::Mat level;
+    m_confidence.scores.convertTo(level, CV_8U, 255.0);
+
+    cv::Mat colors;
+    cv::applyColorMap(level, colors, cv::COLORMAP_JET);
+
+    std::vector<cv::Mat> channels;
+    cv::split(colors, channels);
+    cv::Mat alpha;
+    level.convertTo(alpha, CV_8U, kHeatMapOpacity);
+    channels.push_back(alpha);
+
+    cv::Mat bgra;
+    cv::merge(channels, bgra);
+
+    if (m_state.confidence_texture.valid() && m_confidence_texture_size == bgra.size()) {
+        upload_image(m_backend, m_state.confidence_texture, bgra);
+        return;
+    }
+
+    if (m_state.confidence_texture.valid()) {
+        m_backend.destroy_texture(m_state.confidence_texture);
+    }
+    m_state.confidence_texture = create_image_texture(m_backend, bgra);
+    m_confidence_texture_size = bgra.size();
+}
+
+bool AppController::snap_to_confidence_peak() {
+    const cv::Rect region = m_state.custom_watermark.region;
+    if (m_confidence.empty() || region.size() != m_confidence.logo_size) return false;
+
+    const cv::Mat& scores = m_confidence.scores;
+    const cv::Rect bounds(0, 0, scores.cols, scores.rows);
+    const cv::Point start = region.tl() - m_confidence.origin;
+    if (!bounds.contains(start)) return false;
+
+    // Strongest placement near the release point...
+    const cv::Rect window = cv::Rect(start.x - kSnapRadius, start.y - kSnapRadius,
+                                     2 * kSnapRadius + 1, 2 * kSnapRadius + 1) & bounds;
+    cv::Point peak;
+    cv::minMaxLoc(scores(window), nullptr, nullptr, nullptr, &peak);
+    peak += window.tl();
+
+    // ...then uphill to the local maximum it belongs to
+    for (;;) {
+        cv::Point best = peak;
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                const cv::Point q(peak.x + dx, peak.y + dy);
+                if (bounds.contains(q) && scores.at<float>(q) > scores.at<float>(best)) best = q;
+            }
+        }
+        if (best == peak) break;
+        peak = best;
+    }
+
+    const float score = scores.at<float>(peak);
+    const cv::Point target = peak + m_confidence.origin;
+    if (score < kSnapMinScore || target == region.tl()) return false;
+
+    set_custom_region(cv::Rect(target, region.size()));
+    m_state.status_message = fmt::format("Snapped to ({}, {}), NCC {:.2f}", target.x, target.y, score);
+    spdlog::debug("{}", m_state.status_message);
+    return true;
+}
+
+void AppController::reset_confidence_map() {
+    // Results still in flight are dropped
+    ++m_confidence_generation;
+    {
+        std::lock_guard lock(m_async_mutex);
+        m_confidence_result.reset();
+    }
+
+    m_confidence_pending = false;
+    m_confidence_request = cv::Rect();
+    m_confidence = ConfidenceMap{};
+    m_confidence_dragging = false;
+    upload_confidence_texture();
+}
+
+void AppController::commit_live_preview() {
+    m_live_active = false;
+    EditSnapshot before = std::move(m_live_before);
+    m_live_before = EditSnapshot{};
+
+    if (!m_state.image.has_processed()) return;
+
+    const EditParams params = current_edit_params();
+    m_history.push(EditStep{std::move(before), EditSnapshot{m_state.image.processed, params}});
+    m_applied_params = params;
+
+    m_state.state = ProcessState::Completed;
+    m_state.status_message = m_state.process_options.remove_mode
+        ? "Watermark removed"
+        : "Watermark added";
+    m_state.error_message.clear();
+}
+
+void AppController::undo() {
+    if (!can_undo()) return;
+
+    const EditStep* step = m_history.undo();
+    restore_snapshot(step->before);
+    m_state.status_message = fmt::format("Undo ({} more)", m_history.undo_count());
+}
+
+void AppController::redo() {
+    if (!can_redo()) return;
+
+    const EditStep* step = m_history.redo();
+    restore_snapshot(step->after);
+    m_state.status_message = fmt::format("Redo ({} more)", m_history.redo_count());
+}
+
 // =============================================================================
 // Options
 // =============================================================================
@@ -237,6 +688,9 @@ void AppController::revert_to_original() {
 void AppController::set_remove_mode(bool remove) {
     m_state.process_options.remove_mode = remove;
     spdlog::debug("Mode set to: {}", remove ? "Remove" : "Add");
+
+    // Detection only gates removal
+    if (m_state.batch.is_batch_mode()) select_batch_by_threshold();
 }
 
 void AppController::set_force_size(std::optional<WatermarkSize> size) {
@@ -260,6 +714,7 @@ void AppController::set_force_size(std::optional<WatermarkSize> size) {
     if (m_state.image.has_image()) {
         update_watermark_info();
     }
+    rescan_batch_if_stale();
 }
 
 void AppController::set_size_mode(WatermarkSizeMode mode) {
@@ -291,6 +746,7 @@ void AppController::set_size_mode(WatermarkSizeMode mode) {
     if (m_state.image.has_image()) {
         update_watermark_info();
     }
+    rescan_batch_if_stale();
 
     spdlog::debug("Size mode set to: {}", static_cast<int>(mode));
 }
@@ -322,8 +778,10 @@ void AppController::detect_custom_watermark() {
     m_state.status_message = "Detecting watermark...";
 
     // Run detection
-    auto result = detect_watermark_region(m_state.image.original);
+    apply_custom_detection(detect_watermark_region(m_state.image.original));
+}
 
+void AppController::apply_custom_detection(const std::optional<DetectionResult>& result) {
     if (result && result->detected) {
         m_state.custom_watermark.region = result->region;
         m_state.custom_watermark.has_region = true;
@@ -368,16 +826,163 @@ void AppController::toggle_preview() {
     // Can only toggle if we have processed image
     if (m_state.image.has_processed()) {
         m_state.preview_options.show_processed = !m_state.preview_options.show_processed;
-        update_display_image();
     }
 }
 
+// =============================================================================
+// Folder Navigation
+// =============================================================================
+
+bool AppController::next_image() {
+    return step_image(1);
+}
+
+bool AppController::previous_image() {
+    return step_image(-1);
+}
+
+bool AppController::has_next_image() const noexcept {
+    return !m_state.batch.is_batch_mode() && m_folder_index + 1 < m_folder_files.size();
+}
+
+bool AppController::has_previous_image() const noexcept {
+    return !m_state.batch.is_batch_mode() && !m_folder_files.empty() && m_folder_index > 0;
+}
+
+std::pair<size_t, size_t> AppController::folder_position() const noexcept {
+    if (m_folder_files.empty()) return {0, 0};
+    return {m_folder_index + 1, m_folder_files.size()};
+}
+
+bool AppController::step_image(int delta) {
+    if (delta > 0 ? !has_next_image() : !has_previous_image()) return false;
+
+    m_folder_index = static_cast<size_t>(static_cast<std::ptrdiff_t>(m_folder_index) + delta);
+    return load_image(m_folder_files[m_folder_index]);
+}
+
+void AppController::update_folder(const std::filesystem::path& current, bool rescan) {
+    namespace fs = std::filesystem;
+
+    const fs::path folder = current.parent_path();
+    auto it = std::find(m_folder_files.begin(), m_folder_files.end(), current);
+
+    if (rescan || folder != m_folder || it == m_folder_files.end()) {
+        m_folder = folder;
+        m_folder_files.clear();
+
+        std::error_code ec;
+        for (fs::directory_iterator dir(folder.empty() ? fs::path(".") : folder, ec), end;
+             !ec && dir != end; dir.increment(ec)) {
+            if (dir->is_regular_file(ec) && is_supported_extension(dir->path())) {
+                m_folder_files.push_back(dir->path());
+            }
+        }
+        if (ec) {
+            spdlog::warn("Cannot list {}: {}", folder, ec.message());
+        }
+
+        // Case-insensitive name order, like most file browsers
+        auto key = [](const fs::path& p) {
+            std::string name = filename_utf8(p);
+            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+            return name;
+        };
+        std::sort(m_folder_files.begin(), m_folder_files.end(),
+                  [&](const fs::path& a, const fs::path& b) { return key(a) < key(b); });
+
+        it = std::find(m_folder_files.begin(), m_folder_files.end(), current);
+        if (it == m_folder_files.end()) {
+            // Listed under a different spelling: keep the loaded path
+            m_folder_files.insert(m_folder_files.begin(), current);
+            it = m_folder_files.begin();
+        }
+        spdlog::debug("Folder: {} images in {}", m_folder_files.size(), folder);
+    }
+
+    m_folder_index = static_cast<size_t>(it - m_folder_files.begin());
+    prefetch_neighbors();
+}
+
+void AppController::prefetch_neighbors() {
+    // Nearest first, so the likely next step is decoded first
+    std::vector<std::filesystem::path> window{m_folder_files[m_folder_index]};
+    for (size_t d = 1; d <= kPrefetchRadius; ++d) {
+        if (m_folder_index + d < m_folder_files.size()) {
+            window.push_back(m_folder_files[m_folder_index + d]);
+        }
+        if (m_folder_index >= d) {
+            window.push_back(m_folder_files[m_folder_index - d]);
+        }
+    }
+
+    m_prefetch->retain(window);
+    const uint64_t generation = ++m_prefetch_generation;
+
+    for (size_t i = 1; i < window.size(); ++i) {
+        if (!m_prefetch->begin(window[i])) continue;
+
+        m_workers->submit([this, generation, path = window[i]] {
+            std::shared_ptr<PrefetchedImage> entry;
+
+            // Superseded jobs only release their reservation
+            if (m_prefetch_generation.load(std::memory_order_acquire) == generation) {
+                const auto start = Clock::now();
+                cv::Mat image = cv::imread(path.string(), cv::IMREAD_COLOR);
+                if (!image.empty()) {
+                    entry = std::make_shared<PrefetchedImage>();
+                    entry->detection = m_engine->detect_watermark(image);
+                    entry->detection_run = true;
+                    entry->pyramid = TiledTexture::build_pyramid(image);
+                    entry->image = std::move(image);
+                    spdlog::debug("Prefetched {} in {:.0f} ms", filename_utf8(path), elapsed_ms(start));
+                }
+            }
+            m_prefetch->finish(path, std::move(entry));
+        });
+    }
+}
+
+void AppController::cancel_prefetch() {
+    ++m_prefetch_generation;
+    m_prefetch->clear();
+    m_folder.clear();
+    m_folder_files.clear();
+    m_folder_index = 0;
+}
+
+bool AppController::apply_prefetched_image(const std::filesystem::path& path,
+                                           uint64_t generation, bool need_detection) {
+    auto entry = m_prefetch->find(path);
+    if (!entry || (need_detection && !entry->detection_run)) return false;
+
+    // Same shape as a finished background load; the cached Mats are shared,
+    // which is fine since the original is never modified
+    AsyncResult result;
+    result.kind = AsyncResult::Kind::Loaded;
+    result.generation = generation;
+    result.path = path;
+    result.image = entry->image;
+    result.pyramid = entry->pyramid;
+    result.detection = entry->detection;
+    result.detection_run = need_detection;
+    result.prefetched = true;
+
+    spdlog::info("Image loaded from prefetch cache: {}", filename_utf8(path));
+    apply_loaded_image(result);
+    return true;
+}
+
 // =============================================================================
 // Batch Operations
 // =============================================================================
 
 void AppController::enter_batch_mode(std::span<const std::filesystem::path> files) {
-    // Clean up previous batch thumbnail
+    // Batch jobs get the worker pool (and the memory) to themselves
+    cancel_prefetch();
+
+    // Clean up previous batch thumbnail and pre-scan
+    cancel_batch_scan();
     if (m_state.batch.thumbnail_texture.valid()) {
         m_backend.destroy_texture(m_state.batch.thumbnail_texture);
         m_state.batch.thumbnail_texture = TextureHandle{};
@@ -406,22 +1011,33 @@ void AppController::enter_batch_mode(std::span<const std::filesystem::path> file
     m_state.process_options.force_size = std::nullopt;
 
     // Clear single-image state (batch replaces it)
-    if (m_state.preview_texture.valid()) {
-        m_backend.destroy_texture(m_state.preview_texture);
-        m_state.preview_texture = TextureHandle{};
-    }
+    ++m_task_generation;
+    destroy_preview_textures();
     m_state.image.clear();
     m_state.custom_watermark.clear();
     m_state.watermark_info.reset();
     m_state.state = ProcessState::Idle;
 
-    // Generate thumbnail atlas
-    generate_thumbnail_atlas();
+    // Thumbnails are decoded on demand as the grid scrolls
+    create_thumbnail_pool();
+
+    // Confidence for every file before anything is written
+    start_batch_scan();
 
     m_state.status_message = fmt::format("Batch: {} files ready", m_state.batch.files.size());
 }
 
 void AppController::exit_batch_mode() {
+    // Queued jobs of a running batch become no-ops; their events are ignored
+    if (m_state.batch.in_progress) {
+        ++m_batch_id;
+        spdlog::info("Batch abandoned");
+    }
+
+    // Same for thumbnails still being decoded and the pre-scan
+    reset_thumbnail_pool();
+    cancel_batch_scan();
+
     // Destroy batch thumbnail texture
     if (m_state.batch.thumbnail_texture.valid()) {
         m_backend.destroy_texture(m_state.batch.thumbnail_texture);
@@ -437,6 +1053,13 @@ void AppController::start_batch_processing() {
         spdlog::warn("No files in batch queue");
         return;
     }
+    if (m_state.batch.in_progress) {
+        spdlog::warn("Batch already in progress");
+        return;
+    }
+
+    // Files the pre-scan has not reached are detected while processing
+    cancel_batch_scan();
 
     m_state.batch.current_index = 0;
     m_state.batch.success_count = 0;
@@ -444,168 +1067,509 @@ void AppController::start_batch_processing() {
     m_state.batch.fail_count = 0;
     m_state.batch.in_progress = true;
     m_state.batch.cancel_requested = false;
+    m_batch_cancel = false;
+    const uint64_t batch_id = ++m_batch_id;
 
-    // Reset all file statuses
+    // Reset all file statuses (pre-scan confidence is kept)
     for (auto& f : m_state.batch.files) {
         f.status = BatchFileStatus::Pending;
-        f.confidence = 0.0f;
+        if (!f.scanned) f.confidence = 0.0f;
         f.message.clear();
     }
 
-    spdlog::info("Starting batch processing: {} files (threshold: {:.0f}%)",
+    spdlog::info("Starting batch processing: {} of {} files selected (threshold: {:.0f}%, {} workers)",
+                 m_state.batch.selected_count(),
                  m_state.batch.files.size(),
-                 m_state.batch.detection_threshold * 100.0f);
+                 m_state.batch.detection_threshold * 100.0f,
+                 m_workers->thread_count());
+
+    // Snapshot options: the UI may change them while workers run
+    const bool remove = m_state.process_options.remove_mode;
+    const auto force_size = m_state.process_options.force_size;
+    const auto profile = m_state.process_options.encode_profile;
+    const bool use_detection = m_state.batch.use_detection;
+    const float threshold = m_state.batch.detection_threshold;
+
+    m_batch_pending = 0;
+    for (size_t i = 0; i < m_state.batch.files.size(); ++i) {
+        auto& file = m_state.batch.files[i];
+
+        // Deselected: never opened
+        if (!file.selected) {
+            file.status = BatchFileStatus::Skipped;
+            file.message = "Deselected";
+            m_state.batch.skip_count++;
+            m_state.batch.current_index++;
+            continue;
+        }
+
+        // The pre-scan already decided (the user may have overridden it)
+        const bool detect = use_detection && !file.scanned;
+
+        ++m_batch_pending;
+        m_workers->submit([this, i, batch_id, input = file.path,
+                           remove, force_size, profile, detect, threshold] {
+            if (m_batch_cancel.load(std::memory_order_relaxed) ||
+                m_batch_id.load(std::memory_order_relaxed) != batch_id) {
+                post_event(m_batch_events, {BatchEvent::Kind::Cancelled, batch_id, i, {}});
+                return;
+            }
+            post_event(m_batch_events, {BatchEvent::Kind::Started, batch_id, i, {}});
+            const auto start = Clock::now();
+
+            // Any failure still ends in Finished, so the pending count drains
+            ProcessResult result{};
+            try {
+                // Output = overwrite original (same as CLI simple mode)
+                result = process_image(
+                    input, input,
+                    remove,
+                    *m_engine,
+                    force_size,
+                    detect,
+                    threshold,
+                    profile
+                );
+
+                // File was rewritten: its cached thumbnail is stale
+                if (result.success && !result.skipped) {
+                    m_thumb_cache->invalidate(input);
+                }
+            } catch (const std::exception& e) {
+                result.success = false;
+                result.skipped = false;
+                result.message = std::string("Error: ") + e.what();
+                spdlog::error("Error processing {}: {}", input, e.what());
+            } catch (...) {
+                result.success = false;
+                result.skipped = false;
+                result.message = "Unknown error";
+                spdlog::error("Unknown error processing {}", input);
+            }
+
+            post_event(m_batch_events, {BatchEvent::Kind::Finished, batch_id, i, std::move(result),
+                                        elapsed_ms(start)});
+        });
+    }
 }
 
-bool AppController::process_batch_next() {
-    if (!m_state.batch.in_progress) return false;
-    if (m_state.batch.cancel_requested) {
-        m_state.batch.in_progress = false;
-        m_state.status_message = fmt::format("Batch cancelled ({}/{})",
-                                              m_state.batch.current_index,
-                                              m_state.batch.files.size());
-        return false;
+void AppController::poll_batch_progress() {
+    auto& batch = m_state.batch;
+    if (!batch.in_progress) return;
+
+    bool changed = false;
+    BatchEvent event;
+    while (m_batch_events.try_pop(event)) {
+        if (event.batch_id != m_batch_id.load(std::memory_order_relaxed)) continue;
+        if (event.index >= batch.files.size()) continue;
+        auto& file_result = batch.files[event.index];
+
+        if (event.kind == BatchEvent::Kind::Started) {
+            file_result.status = BatchFileStatus::Processing;
+            continue;
+        }
+
+        --m_batch_pending;
+        if (event.kind == BatchEvent::Kind::Cancelled) continue;
+
+        m_perf.batch_file_ms.add(perf_time(), event.elapsed_ms);
+
+        const auto& proc_result = event.result;
+        if (!file_result.scanned) file_result.confidence = proc_result.confidence;
+        file_result.message = proc_result.message;
+
+        if (proc_result.skipped) {
+            file_result.status = BatchFileStatus::Skipped;
+            batch.skip_count++;
+        } else if (proc_result.success) {
+            file_result.status = BatchFileStatus::OK;
+            batch.success_count++;
+            // Rewritten: the pre-scan no longer describes the file
+            file_result.scanned = false;
+        } else {
+            file_result.status = BatchFileStatus::Failed;
+            batch.fail_count++;
+        }
+
+        // current_index counts completed files (results arrive out of order)
+        batch.current_index++;
+        changed = true;
     }
-    if (m_state.batch.current_index >= m_state.batch.files.size()) {
-        m_state.batch.in_progress = false;
-        m_state.status_message = fmt::format("Batch complete: {} ok, {} skipped, {} failed",
-                                              m_state.batch.success_count,
-                                              m_state.batch.skip_count,
-                                              m_state.batch.fail_count);
-        spdlog::info("{}", m_state.status_message);
 
-        // Regenerate thumbnail atlas to show processed results
-        generate_thumbnail_atlas();
+    if (m_batch_pending == 0) {
+        finish_batch();
+        return;
+    }
 
-        return false;
+    if (changed) {
+        m_state.status_message = fmt::format("Batch: {}/{} (OK:{} Skip:{} Fail:{})",
+                                              batch.current_index,
+                                              batch.files.size(),
+                                              batch.success_count,
+                                              batch.skip_count,
+                                              batch.fail_count);
     }
+}
 
-    auto& file_result = m_state.batch.files[m_state.batch.current_index];
-    file_result.status = BatchFileStatus::Processing;
+void AppController::poll_batch_scan() {
+    auto& batch = m_state.batch;
 
-    const auto& input = file_result.path;
+    ScanEvent event;
+    while (m_scan_events.try_pop(event)) {
+        if (event.generation != m_scan_generation.load(std::memory_order_relaxed)) continue;
+        if (m_scan_in_flight > 0) --m_scan_in_flight;
+        ++batch.scan_done;
+        if (!event.ok || event.index >= batch.files.size()) continue;
+
+        auto& file = batch.files[event.index];
+        file.confidence = event.detection.confidence;
+        file.detected = event.detection.detected;
+        file.scanned = true;
+        file.selected = passes_detection(file);
+    }
 
-    // Output = overwrite original (same as CLI simple mode)
-    std::filesystem::path output = input;
+    if (!batch.scan_in_progress) return;
 
-    // Process using core process_image with detection
-    auto proc_result = process_image(
-        input, output,
-        m_state.process_options.remove_mode,
-        *m_engine,
-        m_state.process_options.force_size,
-        m_state.batch.use_detection,
-        m_state.batch.detection_threshold
-    );
+    // Keep every worker busy without queueing the whole batch ahead of
+    // the thumbnails the grid asks for
+    const size_t max_in_flight = static_cast<size_t>(m_workers->thread_count()) * 2;
+    while (m_scan_in_flight < max_in_flight && m_scan_next < batch.files.size()) {
+        submit_scan(m_scan_next++);
+    }
 
-    file_result.confidence = proc_result.confidence;
-    file_result.message = proc_result.message;
+    if (m_scan_in_flight == 0 && m_scan_next >= batch.files.size()) {
+        batch.scan_in_progress = false;
+        m_state.status_message = fmt::format("Batch: {} files, {} selected",
+                                              batch.files.size(), batch.selected_count());
+        spdlog::info("Batch pre-scan done: {} files, {} selected",
+                     batch.files.size(), batch.selected_count());
+    }
+}
 
-    if (proc_result.skipped) {
-        file_result.status = BatchFileStatus::Skipped;
-        m_state.batch.skip_count++;
-    } else if (proc_result.success) {
-        file_result.status = BatchFileStatus::OK;
-        m_state.batch.success_count++;
-    } else {
-        file_result.status = BatchFileStatus::Failed;
-        m_state.batch.fail_count++;
+void AppController::select_batch_by_threshold() {
+    if (m_state.batch.in_progress) return;
+    for (auto& file : m_state.batch.files) {
+        if (file.scanned) file.selected = passes_detection(file);
     }
+}
 
-    m_state.batch.current_index++;
-    m_state.status_message = fmt::format("Batch: {}/{} (OK:{} Skip:{} Fail:{})",
-                                          m_state.batch.current_index,
-                                          m_state.batch.files.size(),
-                                          m_state.batch.success_count,
-                                          m_state.batch.skip_count,
-                                          m_state.batch.fail_count);
+void AppController::toggle_batch_file(size_t index) {
+    auto& batch = m_state.batch;
+    if (batch.in_progress || index >= batch.files.size()) return;
+    batch.files[index].selected = !batch.files[index].selected;
+}
 
-    return m_state.batch.current_index < m_state.batch.files.size();
+void AppController::sort_batch(BatchSortKey key) {
+    auto& batch = m_state.batch;
+    if (!can_sort_batch() || batch.files.size() < 2) return;
+
+    std::vector<size_t> order(batch.files.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+
+    const auto by_name = [&](size_t a, size_t b) {
+        return batch.files[a].path.filename() < batch.files[b].path.filename();
+    };
+    if (key == BatchSortKey::Confidence) {
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            const auto& fa = batch.files[a];
+            const auto& fb = batch.files[b];
+            if (fa.scanned != fb.scanned) return fa.scanned;
+            if (fa.confidence != fb.confidence) return fa.confidence > fb.confidence;
+            return by_name(a, b);
+        });
+    } else {
+        std::stable_sort(order.begin(), order.end(), by_name);
+    }
+
+    std::vector<BatchFileResult> sorted;
+    sorted.reserve(batch.files.size());
+    for (size_t old_index : order) sorted.push_back(std::move(batch.files[old_index]));
+    batch.files = std::move(sorted);
+
+    // Thumbnails stay in their slots; only the file <-> slot mapping moves
+    std::vector<size_t> new_index(order.size());
+    for (size_t i = 0; i < order.size(); ++i) new_index[order[i]] = i;
+
+    std::fill(m_thumb_slot_of.begin(), m_thumb_slot_of.end(), SIZE_MAX);
+    for (size_t slot = 0; slot < m_thumb_slots.size(); ++slot) {
+        auto& entry = m_thumb_slots[slot];
+        if (entry.file == SIZE_MAX) continue;
+        entry.file = new_index[entry.file];
+        m_thumb_slot_of[entry.file] = slot;
+    }
 }
 
 void AppController::cancel_batch() {
+    if (!m_state.batch.in_progress) return;
     m_state.batch.cancel_requested = true;
+    m_batch_cancel = true;
+    m_state.status_message = "Cancelling batch...";
+}
+
+// =============================================================================
+// Async Task Helpers
+// =============================================================================
+
+uint64_t AppController::begin_async_task() {
+    // Bumping the generation makes in-flight tasks drop their results
+    m_task_progress = 0.0f;
+    m_state.task_progress = 0.0f;
+    return ++m_task_generation;
+}
+
+void AppController::post_async_result(AsyncResult&& result) {
+    {
+        std::lock_guard lock(m_async_mutex);
+        if (!is_current_task(result.generation)) return;
+        m_async_result = std::move(result);
+    }
+    wake_ui();
+}
+
+void AppController::wake_ui() {
+    // One wake-up per frame is enough: the frame drains every queue
+    if (m_wake && !m_wake_pending.exchange(true, std::memory_order_acq_rel)) {
+        m_wake();
+    }
+}
+
+void AppController::apply_loaded_image(AsyncResult& result) {
+    const cv::Mat& image = result.image;
+
+    // Clean up old state completely (including texture)
+    destroy_preview_textures();
+    m_state.reset();
+    m_history.clear();
+    m_live_active = false;
+    reset_confidence_map();
+
+    // Update state with new image
+    m_state.image.file_path = result.path;
+    m_state.image.original = image;
+    m_state.image.width = image.cols;
+    m_state.image.height = image.rows;
+    m_state.image.channels = image.channels();
+
+    // Custom mode: detection already ran on the worker
+    if (result.detection_run) {
+        m_state.custom_watermark.detection_attempted = true;
+        apply_custom_detection(result.detection);
+    }
+
+    // Detect watermark info
+    update_watermark_info();
+    m_applied_params = current_edit_params();
+
+    // Keep the decode for stepping back to this image, then start on its
+    // neighbors
+    if (!result.prefetched) {
+        auto entry = std::make_shared<PrefetchedImage>();
+        entry->image = image;
+        entry->pyramid = result.pyramid;
+        entry->detection = result.detection;
+        entry->detection_run = result.detection_run;
+        m_prefetch->insert(result.path, std::move(entry));
+    }
+    update_folder(result.path);
+
+    // Preview levels were built on the worker
+    m_prepared_pyramid = std::move(result.pyramid);
+    m_state.texture_needs_update = true;
+
+    // Update state
+    m_state.state = ProcessState::Loaded;
+    m_state.status_message = fmt::format("Loaded: {}x{}", image.cols, image.rows);
+    m_state.error_message.clear();
+
+    spdlog::info("Image loaded: {}x{} ({} channels)",
+                 image.cols, image.rows, image.channels());
+}
+
+void AppController::apply_processed_image(AsyncResult& result) {
+    // Image was replaced or closed while processing
+    if (m_state.image.file_path != result.path || !m_state.image.has_image()) return;
+
+    // Record the result; the previous patch is shared, not copied
+    m_history.push(EditStep{
+        EditSnapshot{m_state.image.processed, m_applied_params},
+        EditSnapshot{result.patch, result.params}});
+    m_applied_params = result.params;
+
+    m_state.image.processed = std::move(result.patch);
+    update_overlay_texture();
+
+    // Show processed result
+    m_state.preview_options.show_processed = true;
+
+    m_state.state = ProcessState::Completed;
+    m_state.status_message = m_state.process_options.remove_mode
+        ? "Watermark removed"
+        : "Watermark added";
+    m_state.error_message.clear();
+}
+
+EditParams AppController::current_edit_params() const {
+    const auto& opts = m_state.process_options;
+
+    EditParams params;
+    params.remove_mode = opts.remove_mode;
+    params.size_mode = opts.size_mode;
+    params.force_size = opts.force_size;
+    if (opts.size_mode == WatermarkSizeMode::Custom && m_state.custom_watermark.has_region) {
+        params.custom_region = m_state.custom_watermark.region;
+    }
+    return params;
+}
+
+void AppController::restore_snapshot(const EditSnapshot& snapshot) {
+    const EditParams& params = snapshot.params;
+
+    // Options first, so the highlighted region matches the restored result
+    auto& opts = m_state.process_options;
+    opts.remove_mode = params.remove_mode;
+    opts.size_mode = params.size_mode;
+    opts.force_size = params.force_size;
+    opts.custom_region = params.custom_region;
+
+    if (params.custom_region) {
+        m_state.custom_watermark.region = *params.custom_region;
+        m_state.custom_watermark.has_region = true;
+        m_state.custom_watermark.detection_attempted = true;
+    } else if (params.size_mode != WatermarkSizeMode::Custom) {
+        m_state.custom_watermark.clear();
+    }
+    update_watermark_info();
+    m_applied_params = params;
+
+    m_state.image.processed = snapshot.patch;
+    update_overlay_texture();
+
+    const bool processed = m_state.image.has_processed();
+    m_state.preview_options.show_processed = processed;
+    m_state.state = processed ? ProcessState::Completed : ProcessState::Loaded;
+    m_state.error_message.clear();
 }
 
 // =============================================================================
 // Batch Helpers
 // =============================================================================
 
-void AppController::generate_thumbnail_atlas() {
-    using namespace batch_theme;
+void AppController::finish_batch() {
+    auto& batch = m_state.batch;
+    batch.in_progress = false;
+
+    if (batch.cancel_requested) {
+        m_state.status_message = fmt::format("Batch cancelled ({}/{})",
+                                              batch.current_index,
+                                              batch.files.size());
+        spdlog::info("{}", m_state.status_message);
+        return;
+    }
 
+    m_state.status_message = fmt::format("Batch complete: {} ok, {} skipped, {} failed",
+                                          batch.success_count,
+                                          batch.skip_count,
+                                          batch.fail_count);
+    spdlog::info("{}", m_state.status_message);
+
+    // Refresh the thumbnails of rewritten files that are in the pool
+    std::vector<size_t> changed;
+    for (size_t i = 0; i < batch.files.size(); ++i) {
+        if (batch.files[i].status == BatchFileStatus::OK) changed.push_back(i);
+    }
+    refresh_thumbnails(changed);
+}
+
+void AppController::start_batch_scan() {
     auto& batch = m_state.batch;
+    cancel_batch_scan();
     if (batch.files.empty()) return;
 
-    const int cell_size   = kThumbnailCellSize;
-    const int label_h     = kLabelHeight;
-    const int pad         = kCellPadding;
-    const int gap_v       = kCellGapV;
-    const int thumb_h     = cell_size - label_h;
-    int count = static_cast<int>(std::min(batch.files.size(),
-                                          static_cast<size_t>(kThumbnailMaxCount)));
-
-    // Grid layout
-    batch.thumbnail_cols = kThumbnailCols;
-    batch.thumbnail_rows = (count + batch.thumbnail_cols - 1) / batch.thumbnail_cols;
-
-    // Atlas dimensions (with vertical gaps between rows)
-    int atlas_w = batch.thumbnail_cols * cell_size;
-    int atlas_h = batch.thumbnail_rows * cell_size
-                + (batch.thumbnail_rows > 0 ? (batch.thumbnail_rows - 1) * gap_v : 0);
-
-    // Create atlas (RGBA)
-    cv::Mat atlas(atlas_h, atlas_w, CV_8UC4,
-                  cv::Scalar(kAtlasBgR, kAtlasBgG, kAtlasBgB, kAtlasBgA));
-
-    for (int i = 0; i < count; ++i) {
-        int col = i % batch.thumbnail_cols;
-        int row = i / batch.thumbnail_cols;
-
-        int cell_x = col * cell_size;
-        int cell_y = row * (cell_size + gap_v);
-
-        // Draw cell background
-        cv::rectangle(atlas,
-            cv::Rect(cell_x + pad, cell_y + pad,
-                     cell_size - pad * 2, cell_size - pad * 2),
-            cv::Scalar(kCellBgR, kCellBgG, kCellBgB, kCellBgA), cv::FILLED);
-
-        cv::Mat thumb = cv::imread(batch.files[i].path.string(), cv::IMREAD_COLOR);
-        if (thumb.empty()) continue;
-
-        // Fit thumbnail maintaining aspect ratio (above label area)
-        int avail_w = cell_size - pad * 2;
-        int avail_h = thumb_h - pad * 2;
-        float scale = std::min(
-            static_cast<float>(avail_w) / thumb.cols,
-            static_cast<float>(avail_h) / thumb.rows
-        );
-        int tw = static_cast<int>(thumb.cols * scale);
-        int th = static_cast<int>(thumb.rows * scale);
-
-        cv::Mat resized;
-        cv::resize(thumb, resized, cv::Size(tw, th), 0, 0, cv::INTER_AREA);
-
-        cv::Mat rgba;
-        cv::cvtColor(resized, rgba, cv::COLOR_BGR2RGBA);
-
-        // Center image within cell
-        int ox = cell_x + (cell_size - tw) / 2;
-        int oy = cell_y + pad + (avail_h - th) / 2;
-
-        cv::Rect roi(ox, oy, tw, th);
-        if (roi.x >= 0 && roi.y >= 0 &&
-            roi.x + roi.width <= atlas_w && roi.y + roi.height <= atlas_h) {
-            rgba.copyTo(atlas(roi));
+    for (auto& file : batch.files) {
+        file.scanned = file.detected = false;
+        file.confidence = 0.0f;
+    }
+
+    batch.scan_done = 0;
+    batch.scan_in_progress = true;
+    m_scan_next = 0;
+    m_scan_force_size = m_state.process_options.force_size;
+
+    // Submits the first files
+    poll_batch_scan();
+}
+
+void AppController::cancel_batch_scan() {
+    // Queued scans become no-ops; their events are ignored
+    ++m_scan_generation;
+    m_scan_in_flight = 0;
+    m_state.batch.scan_in_progress = false;
+}
+
+void AppController::submit_scan(size_t index) {
+    const uint64_t generation = m_scan_generation.load();
+
+    ++m_scan_in_flight;
+    m_workers->submit([this, generation, index, force_size = m_scan_force_size,
+                       path = m_state.batch.files[index].path] {
+        ScanEvent event{generation, index};
+
+        if (m_scan_generation.load(std::memory_order_relaxed) == generation) {
+            try {
+                // Detection only reads the logo corner
+                auto region = read_image_region(path, [&](cv::Size size) {
+                    return get_detection_region(size.width, size.height, force_size);
+                });
+                if (region) {
+                    event.detection = m_engine->detect_watermark(
+                        region->pixels, region->image_size, region->origin, force_size);
+                    event.ok = true;
+                } else {
+                    spdlog::warn("Pre-scan: failed to read {}", path);
+                }
+            } catch (const std::exception& e) {
+                event.ok = false;
+                spdlog::warn("Pre-scan: error scanning {}: {}", path, e.what());
+            } catch (...) {
+                event.ok = false;
+                spdlog::warn("Pre-scan: unknown error scanning {}", path);
+            }
         }
 
-        // Thin border
-        cv::rectangle(atlas, roi,
-            cv::Scalar(kCellBorderR, kCellBorderG, kCellBorderB, kCellBorderA), 1);
+        // Posted even when skipped or failed so the in-flight count drains
+        post_event(m_scan_events, std::move(event));
+    });
+}
+
+void AppController::rescan_batch_if_stale() {
+    // The pre-scan detected with the previous watermark size
+    const auto& batch = m_state.batch;
+    if (batch.is_batch_mode() && !batch.in_progress &&
+        m_scan_force_size != m_state.process_options.force_size) {
+        start_batch_scan();
     }
+}
+
+bool AppController::passes_detection(const BatchFileResult& file) const {
+    // Same rule process_image() applies when it detects itself
+    if (!m_state.batch.use_detection || !m_state.process_options.remove_mode) return true;
+    return file.detected || file.confidence >= m_state.batch.detection_threshold;
+}
+
+void AppController::create_thumbnail_pool() {
+    using namespace batch_theme;
+
+    auto& batch = m_state.batch;
+    reset_thumbnail_pool();
+    if (batch.files.empty()) return;
+
+    // One fixed texture of kThumbnailSlotCount cells, whatever the batch size;
+    // the view requests the rows it shows and slots are recycled on scroll
+    const int atlas_w = kThumbnailSlotCols * kThumbnailCellSize;
+    const int atlas_h = kThumbnailSlotRows * kThumbnailCellSize;
+    const cv::Mat atlas(atlas_h, atlas_w, CV_8UC4,
+                        cv::Scalar(kAtlasBgR, kAtlasBgG, kAtlasBgB, kAtlasBgA));
 
-    // Upload atlas as texture
     TextureDesc desc;
     desc.width = atlas_w;
     desc.height = atlas_h;
@@ -616,12 +1580,173 @@ void AppController::generate_thumbnail_atlas() {
     if (batch.thumbnail_texture.valid()) {
         m_backend.destroy_texture(batch.thumbnail_texture);
     }
-
     batch.thumbnail_texture = m_backend.create_texture(desc, data);
-    batch.thumbnails_ready = batch.thumbnail_texture.valid();
+    if (!batch.thumbnail_texture.valid()) return;
+
+    m_thumb_slots.assign(kThumbnailSlotCount, ThumbnailSlot{});
+    m_thumb_slot_of.assign(batch.files.size(), SIZE_MAX);
+
+    spdlog::info("Thumbnail pool created: {}x{} ({} slots of {}px for {} files)",
+                 atlas_w, atlas_h, kThumbnailSlotCount, kThumbnailCellSize, batch.files.size());
+}
+
+void AppController::reset_thumbnail_pool() {
+    // Drop thumbnails still in flight for the previous batch
+    ++m_thumb_generation;
+    m_thumbs_pending = 0;
+    m_thumb_slots.clear();
+    m_thumb_slot_of.clear();
+    m_thumb_frame = 0;
+}
+
+void AppController::request_thumbnails(size_t first, size_t last) {
+    if (m_thumb_slots.empty()) return;
+
+    last = std::min(last, m_thumb_slot_of.size());
+    if (first >= last) return;
+    // Never ask for more than the pool holds (it is sized for a screenful)
+    last = std::min(last, first + m_thumb_slots.size());
+
+    const uint64_t frame = ++m_thumb_frame;
+
+    // Files that already own a slot keep it
+    for (size_t i = first; i < last; ++i) {
+        const size_t slot = m_thumb_slot_of[i];
+        if (slot != SIZE_MAX) m_thumb_slots[slot].last_used = frame;
+    }
+
+    // The rest take over the least recently requested slots
+    for (size_t i = first; i < last; ++i) {
+        if (m_thumb_slot_of[i] != SIZE_MAX) continue;
+
+        auto victim = std::min_element(m_thumb_slots.begin(), m_thumb_slots.end(),
+            [](const ThumbnailSlot& a, const ThumbnailSlot& b) {
+                return a.last_used < b.last_used;
+            });
+        const size_t slot = static_cast<size_t>(victim - m_thumb_slots.begin());
+
+        if (victim->file != SIZE_MAX) m_thumb_slot_of[victim->file] = SIZE_MAX;
+        *victim = ThumbnailSlot{i, frame, false};
+        m_thumb_slot_of[i] = slot;
+
+        submit_thumbnail(slot, i);
+    }
+}
+
+std::optional<cv::Rect2f> AppController::thumbnail_uv(size_t index) const {
+    using namespace batch_theme;
 
-    spdlog::info("Thumbnail atlas generated: {}x{} ({} thumbs, {}px cells, gap {}px)",
-                 atlas_w, atlas_h, count, cell_size, gap_v);
+    if (index >= m_thumb_slot_of.size()) return std::nullopt;
+    const size_t slot = m_thumb_slot_of[index];
+    if (slot == SIZE_MAX || !m_thumb_slots[slot].ready) return std::nullopt;
+
+    constexpr float du = 1.0f / kThumbnailSlotCols;
+    constexpr float dv = 1.0f / kThumbnailSlotRows;
+    return cv::Rect2f(static_cast<float>(slot % kThumbnailSlotCols) * du,
+                      static_cast<float>(slot / kThumbnailSlotCols) * dv, du, dv);
+}
+
+void AppController::refresh_thumbnails(std::span<const size_t> indices) {
+    // Files scrolled out of the pool are decoded afresh when they come back
+    for (size_t index : indices) {
+        if (index >= m_thumb_slot_of.size()) continue;
+        const size_t slot = m_thumb_slot_of[index];
+        if (slot != SIZE_MAX) submit_thumbnail(slot, index);
+    }
+}
+
+void AppController::submit_thumbnail(size_t slot, size_t index) {
+    using namespace batch_theme;
+
+    const int thumb_h = kThumbnailCellSize - kLabelHeight;
+    const cv::Size fit(kThumbnailCellSize - kCellPadding * 2, thumb_h - kCellPadding * 2);
+    const uint64_t generation = m_thumb_generation.load();
+    const uint64_t ticket = m_thumb_tickets[slot].fetch_add(1) + 1;
+
+    ++m_thumbs_pending;
+    m_workers->submit([this, generation, slot, ticket, index, fit,
+                       path = m_state.batch.files[index].path] {
+        ThumbnailEvent event{generation, index, slot, ticket, {}};
+
+        // Skip files that were scrolled away before the decode started
+        if (m_thumb_generation.load(std::memory_order_relaxed) == generation &&
+            m_thumb_tickets[slot].load(std::memory_order_relaxed) == ticket) {
+            cv::Mat thumb = m_thumb_cache->load(path, fit);
+            if (thumb.empty()) {
+                thumb = load_thumbnail(path, fit);
+                if (!thumb.empty()) m_thumb_cache->store(path, fit, thumb);
+            }
+            if (!thumb.empty()) event.rgba = compose_thumbnail_cell(thumb);
+        }
+
+        // Posted even when skipped or failed (empty rgba) so the pending count drains
+        post_event(m_thumb_events, std::move(event));
+    });
+}
+
+void AppController::poll_thumbnails() {
+    using namespace batch_theme;
+
+    const TextureHandle texture = m_state.batch.thumbnail_texture;
+    ThumbnailEvent event;
+    while (m_thumb_events.try_pop(event)) {
+        if (event.generation != m_thumb_generation.load(std::memory_order_relaxed)) continue;
+        if (m_thumbs_pending > 0) --m_thumbs_pending;
+        if (event.rgba.empty() || !texture.valid()) continue;
+
+        // The slot may have been handed to another file meanwhile
+        if (event.slot >= m_thumb_slots.size() ||
+            m_thumb_tickets[event.slot].load(std::memory_order_relaxed) != event.ticket) {
+            continue;
+        }
+
+        const uint32_t cell = static_cast<uint32_t>(kThumbnailCellSize);
+        TextureRect rect{static_cast<uint32_t>(event.slot % kThumbnailSlotCols) * cell,
+                         static_cast<uint32_t>(event.slot / kThumbnailSlotCols) * cell,
+                         cell, cell};
+        std::span<const uint8_t> data(event.rgba.data,
+                                      event.rgba.total() * event.rgba.elemSize());
+        m_backend.update_texture_region(texture, rect, data, event.rgba.step);
+        m_thumb_slots[event.slot].ready = true;
+    }
+}
+
+// =============================================================================
+// Frame Scheduling
+// =============================================================================
+
+bool AppController::wants_continuous_update() const {
+    return m_state.is_busy() ||
+           m_state.batch.in_progress ||
+           m_state.show_perf_overlay ||
+           m_state.texture_needs_update ||
+           m_live_active ||
+           m_preview_tiles->has_pending_uploads();
+}
+
+// =============================================================================
+// Diagnostics
+// =============================================================================
+
+float AppController::perf_time() const noexcept {
+    return std::chrono::duration<float>(Clock::now() - m_perf_epoch).count();
+}
+
+void AppController::record_frame_stats() {
+    const auto now = Clock::now();
+    const float t = std::chrono::duration<float>(now - m_perf_epoch).count();
+    const float frame_ms = std::chrono::duration<float, std::milli>(now - m_perf_last_frame).count();
+    m_perf_last_frame = now;
+
+    // Work of the frame that just ended
+    const uint64_t uploaded = m_backend.bytes_uploaded();
+    m_perf.frame_ms.add(t, frame_ms);
+    m_perf.texture_ms.add(t, m_frame_texture_ms);
+    m_perf.upload_kib.add(t, static_cast<float>(uploaded - m_perf_uploaded) / 1024.0f);
+    m_perf.queue_depth.add(t, static_cast<float>(m_workers->pending() + m_task_workers->pending()));
+
+    m_perf_uploaded = uploaded;
+    m_frame_texture_ms = 0.0f;
 }
 
 // =============================================================================
@@ -630,18 +1755,26 @@ void AppController::generate_thumbnail_atlas() {
 
 void AppController::update_texture_if_needed() {
     if (!m_state.texture_needs_update) return;
-    if (m_state.image.display.empty()) return;
+    if (m_state.image.original.empty()) return;
 
+    const auto start = Clock::now();
     create_or_update_texture();
     m_state.texture_needs_update = false;
+    m_frame_texture_ms += elapsed_ms(start);
 }
 
 void AppController::invalidate_texture() {
     m_state.texture_needs_update = true;
 }
 
-void* AppController::get_preview_texture_id() const {
-    return m_backend.get_imgui_texture_id(m_state.preview_texture);
+void* AppController::get_overlay_texture_id() const {
+    if (!m_state.overlay_texture.valid()) return nullptr;
+    return m_backend.get_imgui_texture_id(m_state.overlay_texture);
+}
+
+void* AppController::get_confidence_texture_id() const {
+    if (!m_state.confidence_texture.valid()) return nullptr;
+    return m_backend.get_imgui_texture_id(m_state.confidence_texture);
 }
 
 void* AppController::get_batch_thumbnail_texture_id() const {
@@ -727,65 +1860,80 @@ void AppController::update_watermark_info() {
                   config.logo_size, config.logo_size, pos.x, pos.y);
 }
 
-void AppController::update_display_image() {
-    if (!m_state.image.has_image()) {
-        m_state.image.display.release();
-        m_state.texture_needs_update = true;
-        return;
+void AppController::create_or_update_texture() {
+    const cv::Mat& original = m_state.image.original;
+    if (original.empty()) return;
+
+    // Use the worker's pyramid if it matches; tiles upload lazily when drawn
+    std::vector<cv::Mat> levels = std::move(m_prepared_pyramid);
+    m_prepared_pyramid.clear();
+    if (levels.empty() || levels.front().data != original.data) {
+        levels = TiledTexture::build_pyramid(original);
     }
+    m_preview_tiles->set_pyramid(std::move(levels));
+}
 
-    if (m_state.preview_options.show_processed && m_state.image.has_processed()) {
-        m_state.image.display = m_state.image.processed;
-    } else {
-        m_state.image.display = m_state.image.original;
-    }
+void AppController::update_overlay_texture() {
+    // The preview texture always holds the original; ImagePreview draws
+    // this patch over it when the processed result is shown
+    const ImagePatch& patch = m_state.image.processed;
+    const cv::Rect rect = patch.rect & cv::Rect(0, 0, m_state.image.width, m_state.image.height);
 
-    m_state.texture_needs_update = true;
-}
+    if (rect.empty() || patch.empty() || rect != patch.rect) {
+        if (m_state.overlay_texture.valid()) {
+            m_backend.destroy_texture(m_state.overlay_texture);
+            m_state.overlay_texture = TextureHandle{};
+        }
+        return;
+    }
 
-void AppController::create_or_update_texture() {
-    if (m_state.image.display.empty()) return;
+    // Converted straight into upload memory, at the texture's top-left
+    // (see overlay_uv_max)
+    m_overlay_used = rect.size();
+    if (m_state.overlay_texture.valid() &&
+        rect.width <= m_overlay_size.width && rect.height <= m_overlay_size.height) {
+        upload_image(m_backend, m_state.overlay_texture, patch.pixels);
+        return;
+    }
 
-    // Prepare texture data (BGR -> RGBA)
-    cv::Mat rgba = prepare_texture_data(m_state.image.display);
+    if (m_state.overlay_texture.valid()) {
+        m_backend.destroy_texture(m_state.overlay_texture);
+    }
 
-    // Create texture description
     TextureDesc desc;
-    desc.width = rgba.cols;
-    desc.height = rgba.rows;
+    desc.width = overlay_capacity(rect.width);
+    desc.height = overlay_capacity(rect.height);
     desc.format = TextureFormat::RGBA8;
 
-    // Create span from cv::Mat data
-    std::span<const uint8_t> data(rgba.data, rgba.total() * rgba.elemSize());
-
-    if (!m_state.preview_texture.valid()) {
-        // Create new texture
-        TextureHandle result = m_backend.create_texture(desc, data);
-        if (result.valid()) {
-            m_state.preview_texture = result;
-        } else {
-            spdlog::error("Failed to create texture: {}", to_string(m_backend.last_error()));
+    m_state.overlay_texture = m_backend.create_texture(desc);
+    if (!m_state.overlay_texture.valid() ||
+        !upload_image(m_backend, m_state.overlay_texture, patch.pixels)) {
+        spdlog::error("Failed to create overlay texture: {}", to_string(m_backend.last_error()));
+        if (m_state.overlay_texture.valid()) {
+            m_backend.destroy_texture(m_state.overlay_texture);
+            m_state.overlay_texture = TextureHandle{};
         }
-    } else {
-        // Update existing texture
-        m_backend.update_texture(m_state.preview_texture, data);
+        return;
     }
+    m_overlay_size = cv::Size(static_cast<int>(desc.width), static_cast<int>(desc.height));
 }
 
-cv::Mat AppController::prepare_texture_data(const cv::Mat& image) {
-    cv::Mat rgba;
+cv::Point2f AppController::overlay_uv_max() const {
+    if (m_overlay_size.empty()) return cv::Point2f(1.0f, 1.0f);
+    return cv::Point2f(static_cast<float>(m_overlay_used.width) / m_overlay_size.width,
+                       static_cast<float>(m_overlay_used.height) / m_overlay_size.height);
+}
 
-    if (image.channels() == 3) {
-        cv::cvtColor(image, rgba, cv::COLOR_BGR2RGBA);
-    } else if (image.channels() == 4) {
-        cv::cvtColor(image, rgba, cv::COLOR_BGRA2RGBA);
-    } else if (image.channels() == 1) {
-        cv::cvtColor(image, rgba, cv::COLOR_GRAY2RGBA);
-    } else {
-        rgba = image.clone();
+void AppController::destroy_preview_textures() {
+    if (m_preview_tiles) m_preview_tiles->clear();
+    if (m_state.overlay_texture.valid()) {
+        m_backend.destroy_texture(m_state.overlay_texture);
+        m_state.overlay_texture = TextureHandle{};
+    }
+    if (m_state.confidence_texture.valid()) {
+        m_backend.destroy_texture(m_state.confidence_texture);
+        m_state.confidence_texture = TextureHandle{};
     }
-
-    return rgba;
 }
 
 }  // namespace gwt::gui
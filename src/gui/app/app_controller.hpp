@@ -12,12 +12,31 @@
 #pragma once
 
 #include "gui/app/app_state.hpp"
+#include "gui/app/edit_history.hpp"
+#include "gui/app/perf_stats.hpp"
+#include "gui/app/prefetch_cache.hpp"
+#include "gui/app/thumbnail_cache.hpp"
+#include "gui/app/worker_pool.hpp"
 #include "gui/backend/render_backend.hpp"
+#include "gui/backend/tiled_texture.hpp"
+#include "core/watermark_detector.hpp"
 #include "core/watermark_engine.hpp"
-
+#include "utils/mpmc_queue.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <filesystem>
 #include <span>
+#include <utility>
+#include <vector>
 
 namespace gwt::gui {
 
@@ -51,14 +70,57 @@ public:
      */
     [[nodiscard]] AppState& state() noexcept { return m_state; }
 
+    // ==========================================================================
+    // Frame Scheduling
+    // ==========================================================================
+
+    /**
+     * True while the screen changes without user input (load/process or
+     * batch running, preview tiles still uploading, performance overlay
+     * open, live preview not yet committed); the main loop keeps
+     * rendering at full rate instead of waiting for events
+     */
+    [[nodiscard]] bool wants_continuous_update() const;
+
+    /**
+     * Set the callback used to wake an idle main loop when a worker posts
+     * a result. Called from worker threads, at most once per frame; set it
+     * before loading anything.
+     */
+    void set_wake_callback(std::function<void()> callback) { m_wake = std::move(callback); }
+
+    // ==========================================================================
+    // Diagnostics
+    // ==========================================================================
+
+    /**
+     * Rolling frame, upload, queue and task timings (see PerfOverlay)
+     */
+    [[nodiscard]] const PerfStats& perf_stats() const noexcept { return m_perf; }
+
+    /**
+     * Seconds since the controller was created (x axis of perf_stats())
+     */
+    [[nodiscard]] float perf_time() const noexcept;
+
+    /**
+     * Sample the per-frame series (call once at the start of each frame)
+     */
+    void record_frame_stats();
+
     // ==========================================================================
     // Image Operations
     // ==========================================================================
 
     /**
-     * Load an image from file
+     * Load an image from file (asynchronous)
+     *
+     * Decoding runs on a worker thread; the current image stays on screen
+     * until poll_async_tasks() picks up the result. A newer load or process
+     * request supersedes one still in flight.
+     *
      * @param path  Path to image file
-     * @return      true if successful
+     * @return      true if the load was started
      */
     bool load_image(const std::filesystem::path& path);
 
@@ -74,21 +136,97 @@ public:
      */
     void close_image();
 
+    // ==========================================================================
+    // Folder Navigation
+    // ==========================================================================
+
+    /**
+     * Load the next / previous supported image in the current image's
+     * folder (sorted by name)
+     *
+     * The kPrefetchRadius images on either side of the current one are
+     * decoded in the background (with preview levels and detection), so
+     * stepping usually shows the image within the same frame.
+     *
+     * @return true if a load was started
+     */
+    bool next_image();
+    bool previous_image();
+
+    [[nodiscard]] bool has_next_image() const noexcept;
+    [[nodiscard]] bool has_previous_image() const noexcept;
+
+    /**
+     * 1-based index of the current image in its folder, and the number of
+     * images there (0 / 0 if unknown)
+     */
+    [[nodiscard]] std::pair<size_t, size_t> folder_position() const noexcept;
+
     // ==========================================================================
     // Processing Operations
     // ==========================================================================
 
     /**
-     * Process current image (remove or add watermark)
-     * Uses current process_options
+     * Process current image (remove or add watermark) on a worker thread
+     * Uses a snapshot of the current process_options
      */
     void process_current();
 
+    /**
+     * Apply a finished background load/process result (call once per frame)
+     */
+    void poll_async_tasks();
+
     /**
      * Revert to original image
      */
     void revert_to_original();
 
+    /**
+     * Custom mode live preview (call once per frame)
+     *
+     * While the custom rect is being drawn or dragged, re-processes just
+     * the pixels under it whenever it moved and shows the result; the
+     * final result is added to the history when the mouse is released.
+     */
+    void update_live_preview();
+
+    /**
+     * Custom mode confidence heat map (call once per frame, before
+     * update_live_preview)
+     *
+     * While preview_options.show_confidence_map is set, scores every
+     * placement of the custom rect in a neighborhood around it on a
+     * worker; a new map is requested only when the rect changes size or
+     * leaves the middle of the scored area. When a drag ends, the rect
+     * snaps to the nearest strong local maximum.
+     */
+    void update_confidence_map();
+
+    /**
+     * Latest confidence map (empty if none)
+     */
+    [[nodiscard]] const ConfidenceMap& confidence_map() const noexcept { return m_confidence; }
+
+    /**
+     * Step back to the previous processing result and its options
+     * (only the overlay patch is re-uploaded)
+     */
+    void undo();
+
+    /**
+     * Re-apply the last undone processing result
+     */
+    void redo();
+
+    [[nodiscard]] bool can_undo() const noexcept { return !m_state.is_busy() && m_history.can_undo(); }
+    [[nodiscard]] bool can_redo() const noexcept { return !m_state.is_busy() && m_history.can_redo(); }
+
+    /**
+     * Processing history of the current image
+     */
+    [[nodiscard]] const EditHistory& history() const noexcept { return m_history; }
+
     // ==========================================================================
     // Options
     // ==========================================================================
@@ -124,7 +262,7 @@ public:
     void detect_custom_watermark();
 
     /**
-     * Toggle between original and processed preview
+     * Toggle between original and processed preview (no texture upload)
      */
     void toggle_preview();
 
@@ -134,7 +272,8 @@ public:
 
     /**
      * Enter batch mode with multiple files (from drag & drop)
-     * Generates thumbnail atlas and prepares batch state
+     * Prepares batch state and thumbnails, and starts the detection
+     * pre-scan (see poll_batch_scan)
      * @param files  Paths to process
      */
     void enter_batch_mode(std::span<const std::filesystem::path> files);
@@ -146,20 +285,79 @@ public:
 
     /**
      * Start batch processing (after user confirms)
+     * Files are processed on the worker pool; progress arrives via
+     * poll_batch_progress(). Deselected files are skipped without being
+     * opened, and pre-scanned files are not detected again.
      */
     void start_batch_processing();
 
     /**
-     * Process next file in batch (call from main loop)
-     * @return  true if more files to process
+     * Apply pre-scan results and keep the scan fed (call once per frame)
+     *
+     * The pre-scan runs detection on every batch file in parallel, decoding
+     * only the watermark corner where the format allows. Each result fills
+     * BatchFileResult::confidence and selects the file if it passes the
+     * detection threshold.
+     */
+    void poll_batch_scan();
+
+    /**
+     * Select the pre-scanned files that pass the current detection settings
+     * and deselect the rest (call after changing them)
+     */
+    void select_batch_by_threshold();
+
+    /**
+     * Include or exclude one file from processing
      */
-    bool process_batch_next();
+    void toggle_batch_file(size_t index);
+
+    /**
+     * Reorder the batch (not while processing or pre-scanning)
+     */
+    void sort_batch(BatchSortKey key);
+    [[nodiscard]] bool can_sort_batch() const noexcept {
+        return !m_state.batch.in_progress && !m_state.batch.scan_in_progress;
+    }
+
+    /**
+     * Apply results posted by batch workers (call once per frame)
+     * Updates file statuses and counters; finishes the batch when all
+     * submitted files have reported back
+     */
+    void poll_batch_progress();
 
     /**
      * Cancel batch processing
+     * Files already being processed finish; queued files are not started
      */
     void cancel_batch();
 
+    /**
+     * Copy finished thumbnails into the batch atlas (call once per frame)
+     */
+    void poll_thumbnails();
+
+    /**
+     * Make thumbnails of files [first, last) resident (call every frame
+     * with the visible rows plus lookahead)
+     *
+     * Files without one get the least recently requested slot of the pool
+     * and a background decode; at most the pool size is honored.
+     */
+    void request_thumbnails(size_t first, size_t last);
+
+    /**
+     * Texture coordinates (x, y, width, height) of a file's thumbnail cell
+     * in the batch thumbnail texture; nullopt until it has been decoded
+     */
+    [[nodiscard]] std::optional<cv::Rect2f> thumbnail_uv(size_t index) const;
+
+    /**
+     * True while requested thumbnails have not all been applied
+     */
+    [[nodiscard]] bool thumbnails_loading() const noexcept { return m_thumbs_pending > 0; }
+
     // ==========================================================================
     // Texture Management
     // ==========================================================================
@@ -176,9 +374,27 @@ public:
     void invalidate_texture();
 
     /**
-     * Get ImGui texture ID for preview
+     * Tiled preview of the original image (drawn by ImagePreview)
      */
-    [[nodiscard]] void* get_preview_texture_id() const;
+    [[nodiscard]] TiledTexture& preview_tiles() noexcept { return *m_preview_tiles; }
+
+    /**
+     * Get ImGui texture ID for the processed patch (nullptr if none)
+     * Drawn over the preview texture at image.processed.rect
+     */
+    [[nodiscard]] void* get_overlay_texture_id() const;
+
+    /**
+     * Texture coordinates of the patch's bottom-right corner; the overlay
+     * texture is reused while it is large enough, so it may be bigger
+     */
+    [[nodiscard]] cv::Point2f overlay_uv_max() const;
+
+    /**
+     * Get ImGui texture ID for the confidence heat map (nullptr if none)
+     * Texel (x, y) scores the rect placed at confidence_map().origin + (x, y)
+     */
+    [[nodiscard]] void* get_confidence_texture_id() const;
 
     /**
      * Get ImGui texture ID for batch thumbnail atlas
@@ -200,18 +416,225 @@ public:
     [[nodiscard]] static bool is_supported_extension(const std::filesystem::path& path);
 
 private:
+    /**
+     * Batch worker -> UI thread notification
+     */
+    struct BatchEvent {
+        enum class Kind {
+            Started,    // Worker picked up the file
+            Finished,   // Result is valid
+            Cancelled   // Not processed (batch was cancelled first)
+        };
+
+        Kind kind{Kind::Finished};
+        uint64_t batch_id{0};
+        size_t index{0};
+        ProcessResult result;
+        float elapsed_ms{0.0f};     // Finished: worker time for the file
+    };
+
+    /**
+     * Thumbnail worker -> UI thread: one decoded cell for a pool slot
+     */
+    struct ThumbnailEvent {
+        uint64_t generation{0};
+        size_t index{0};
+        size_t slot{0};
+        uint64_t ticket{0};         // Slot assignment the decode was made for
+        cv::Mat rgba;               // Whole cell, empty if skipped or failed
+    };
+
+    /**
+     * One cell of the thumbnail pool
+     */
+    struct ThumbnailSlot {
+        size_t file{SIZE_MAX};      // Batch file index shown, SIZE_MAX if free
+        uint64_t last_used{0};      // request_thumbnails() call that last wanted it
+        bool ready{false};          // Holds a decoded thumbnail of file
+    };
+
+    /**
+     * Pre-scan worker -> UI thread: detection result for one file
+     */
+    struct ScanEvent {
+        uint64_t generation{0};
+        size_t index{0};
+        bool ok{false};             // Watermark corner decoded; detection is valid
+        DetectionResult detection{};
+    };
+
+    static constexpr size_t kBatchEventCapacity = 1024;
+    static constexpr size_t kScanEventCapacity = 256;
+    static constexpr size_t kThumbnailEventCapacity = 256;
+    static constexpr size_t kPrefetchRadius = 2;  // Neighbors decoded ahead on each side
+    static constexpr size_t kThumbnailSlotCount =
+        static_cast<size_t>(batch_theme::kThumbnailSlotCols * batch_theme::kThumbnailSlotRows);
+
+    /**
+     * Result of a background load/process task
+     */
+    struct AsyncResult {
+        enum class Kind {
+            Loaded,     // image = decoded original
+            Processed,  // patch = processed watermark region
+            Failed      // error is set
+        };
+
+        Kind kind{Kind::Failed};
+        uint64_t generation{0};
+        std::filesystem::path path;
+        cv::Mat image;                              // Decoded original (load only)
+        std::vector<cv::Mat> pyramid;               // Preview mip levels of image (load only)
+        ImagePatch patch;                           // Processing result (process only)
+        EditParams params;                          // Options that produced patch (process only)
+        bool detection_run{false};                  // Custom-mode detection was done
+        bool prefetched{false};                     // Taken from the prefetch cache
+        std::optional<DetectionResult> detection;
+        std::string error;
+        float elapsed_ms{0.0f};                     // Worker time
+    };
+
     AppState m_state;
     IRenderBackend& m_backend;
     std::unique_ptr<WatermarkEngine> m_engine;
 
+    // Batch worker state
+    MpmcQueue<BatchEvent> m_batch_events{kBatchEventCapacity};
+    std::atomic<bool> m_batch_cancel{false};
+    std::atomic<bool> m_shutting_down{false};
+    size_t m_batch_pending{0};              // Submitted, not yet Finished/Cancelled
+    std::atomic<uint64_t> m_batch_id{0};    // Jobs from an older batch become no-ops
+
+    // Detection pre-scan (fed a few files at a time so thumbnails interleave)
+    MpmcQueue<ScanEvent> m_scan_events{kScanEventCapacity};
+    std::atomic<uint64_t> m_scan_generation{0};
+    std::optional<WatermarkSize> m_scan_force_size;
+    size_t m_scan_next{0};                  // Next file to submit
+    size_t m_scan_in_flight{0};             // Submitted, not yet polled
+
+    // Thumbnail slot pool (filled on demand by workers)
+    MpmcQueue<ThumbnailEvent> m_thumb_events{kThumbnailEventCapacity};
+    std::atomic<uint64_t> m_thumb_generation{0};
+    std::array<std::atomic<uint64_t>, kThumbnailSlotCount> m_thumb_tickets{};  // Bumped on reassignment
+    std::vector<ThumbnailSlot> m_thumb_slots;
+    std::vector<size_t> m_thumb_slot_of;    // Per batch file: slot index, or SIZE_MAX
+    uint64_t m_thumb_frame{0};              // request_thumbnails() calls so far
+    size_t m_thumbs_pending{0};             // Submitted for the current generation, not yet polled
+    std::unique_ptr<ThumbnailCache> m_thumb_cache;
+
+    // Preview of the original image (tiles uploaded on demand)
+    std::unique_ptr<TiledTexture> m_preview_tiles;
+
+    // Interactive load/process tasks (latest wins)
+    std::atomic<uint64_t> m_task_generation{0};
+    std::atomic<float> m_task_progress{0.0f};
+    std::mutex m_async_mutex;
+    std::optional<AsyncResult> m_async_result;  // Single-slot mailbox, guarded by m_async_mutex
+    std::vector<cv::Mat> m_prepared_pyramid;    // Pre-built levels for the next upload
+    cv::Size m_overlay_size;                    // Size of overlay_texture
+    cv::Size m_overlay_used;                    // Part of it holding the current patch
+
+    // Undo/redo of processing results (UI thread only)
+    EditHistory m_history;
+    EditParams m_applied_params;                // Options behind image.processed
+
+    // Custom mode live preview (see update_live_preview)
+    bool m_live_active{false};
+    cv::Rect m_live_region;                     // Region of the patch on screen
+    EditSnapshot m_live_before;                 // Result before the drag started
+
+    // Folder browsing (UI thread only, except the cache)
+    std::filesystem::path m_folder;
+    std::vector<std::filesystem::path> m_folder_files;  // Supported images, sorted by name
+    size_t m_folder_index{0};                   // Current image in m_folder_files
+    std::unique_ptr<PrefetchCache> m_prefetch;
+    std::atomic<uint64_t> m_prefetch_generation{0};  // Older prefetch jobs become no-ops
+
+    // Custom mode confidence map (see update_confidence_map)
+    struct ConfidenceResult {
+        uint64_t generation{0};
+        ConfidenceMap map;
+    };
+    std::atomic<uint64_t> m_confidence_generation{0};
+    std::optional<ConfidenceResult> m_confidence_result;  // Guarded by m_async_mutex
+    bool m_confidence_pending{false};           // A map job is queued or running
+    cv::Rect m_confidence_request;              // Rect the latest map was requested for
+    ConfidenceMap m_confidence;
+    cv::Mat m_confidence_template;              // Alpha map at the requested rect size
+    cv::Size m_confidence_texture_size;
+    bool m_confidence_dragging{false};          // Custom rect was being dragged last frame
+
+    // Diagnostics (UI thread only)
+    PerfStats m_perf;
+    std::chrono::steady_clock::time_point m_perf_epoch{std::chrono::steady_clock::now()};
+    std::chrono::steady_clock::time_point m_perf_last_frame{m_perf_epoch};
+    uint64_t m_perf_uploaded{0};                // Backend upload counter at the last sample
+    float m_frame_texture_ms{0.0f};             // update_texture_if_needed() time this frame
+
+    // Main loop wake-up (see set_wake_callback)
+    std::function<void()> m_wake;
+    std::atomic<bool> m_wake_pending{false};    // Cleared by poll_async_tasks()
+
+    // Declared last so workers are joined before anything they reference
+    std::unique_ptr<WorkerPool> m_workers;          // Batch jobs
+    std::unique_ptr<WorkerPool> m_task_workers;     // Load/process (never queued behind a batch)
+
     // Internal helpers
     void update_watermark_info();
-    void update_display_image();
     void create_or_update_texture();
-    cv::Mat prepare_texture_data(const cv::Mat& image);
+    void update_overlay_texture();
+    void destroy_preview_textures();
+    void apply_custom_detection(const std::optional<DetectionResult>& result);
+
+    // Async task helpers
+    uint64_t begin_async_task();
+    [[nodiscard]] bool is_current_task(uint64_t generation) const noexcept {
+        return m_task_generation.load(std::memory_order_acquire) == generation;
+    }
+    void post_async_result(AsyncResult&& result);
+    void wake_ui();
+    void apply_loaded_image(AsyncResult& result);
+    void apply_processed_image(AsyncResult& result);
+    [[nodiscard]] EditParams current_edit_params() const;
+    void restore_snapshot(const EditSnapshot& snapshot);
+    void refresh_live_patch();
+    void commit_live_preview();
+    void request_confidence_map();
+    void upload_confidence_texture();
+    bool snap_to_confidence_peak();
+    void reset_confidence_map();
+
+    // Folder helpers
+    bool step_image(int delta);
+    void update_folder(const std::filesystem::path& current, bool rescan = false);
+    void prefetch_neighbors();
+    void cancel_prefetch();
+    bool apply_prefetched_image(const std::filesystem::path& path, uint64_t generation, bool need_detection);
 
     // Batch helpers
-    void generate_thumbnail_atlas();
+    void create_thumbnail_pool();
+    void reset_thumbnail_pool();
+    void refresh_thumbnails(std::span<const size_t> indices);
+    void submit_thumbnail(size_t slot, size_t index);
+    void finish_batch();
+    void start_batch_scan();
+    void cancel_batch_scan();
+    void submit_scan(size_t index);
+    void rescan_batch_if_stale();
+    [[nodiscard]] bool passes_detection(const BatchFileResult& file) const;
+
+    /**
+     * Post a worker event; the UI drains queues every frame, so a full
+     * queue is transient (gives up only during shutdown)
+     */
+    template <typename T>
+    void post_event(MpmcQueue<T>& queue, T&& event) {
+        while (!queue.try_push(std::move(event))) {
+            if (m_shutting_down.load(std::memory_order_relaxed)) return;
+            std::this_thread::yield();
+        }
+        wake_ui();
+    }
 };
 
 }  // namespace gwt::gui
@@ -16,6 +16,7 @@
 #include "gui/resources/style.hpp"
 
 #include <opencv2/core.hpp>
+#include <algorithm>
 #include <filesystem>
 #include <optional>
 #include <string>
@@ -32,6 +33,7 @@ namespace gwt::gui {
  */
 enum class ProcessState {
     Idle,           // No image loaded
+    Loading,        // Image is being decoded in the background
     Loaded,         // Image loaded, ready to process
     Processing,     // Currently processing
     Completed,      // Processing completed
@@ -41,6 +43,7 @@ enum class ProcessState {
 [[nodiscard]] constexpr std::string_view to_string(ProcessState state) noexcept {
     switch (state) {
         case ProcessState::Idle:       return "Idle";
+        case ProcessState::Loading:    return "Loading";
         case ProcessState::Loaded:     return "Loaded";
         case ProcessState::Processing: return "Processing";
         case ProcessState::Completed:  return "Completed";
@@ -139,14 +142,36 @@ struct WatermarkInfo {
 // Image State
 // =============================================================================
 
+/**
+ * Pixels replacing a rectangle of a base image
+ *
+ * Processing only touches the watermark box, so a result is stored as
+ * this small patch over the shared original instead of a full copy.
+ */
+struct ImagePatch {
+    cv::Rect rect;          // In base image coordinates
+    cv::Mat pixels;         // rect.size(), same type as the base image
+
+    [[nodiscard]] bool empty() const noexcept { return pixels.empty(); }
+    [[nodiscard]] size_t bytes() const noexcept { return pixels.total() * pixels.elemSize(); }
+
+    /**
+     * Full frame: a copy of base with the patch applied
+     */
+    [[nodiscard]] cv::Mat apply(const cv::Mat& base) const {
+        cv::Mat frame = base.clone();
+        if (!empty()) pixels.copyTo(frame(rect));
+        return frame;
+    }
+};
+
 /**
  * Current image state
  */
 struct ImageState {
     std::optional<std::filesystem::path> file_path;
     cv::Mat original;       // Original loaded image
-    cv::Mat processed;      // After watermark processing
-    cv::Mat display;        // Currently displayed (original or processed)
+    ImagePatch processed;   // Processing result over original
 
     int width{0};
     int height{0};
@@ -158,8 +183,7 @@ struct ImageState {
     void clear() {
         file_path.reset();
         original.release();
-        processed.release();
-        display.release();
+        processed = ImagePatch{};
         width = height = channels = 0;
     }
 };
@@ -176,6 +200,7 @@ struct ProcessOptions {
     WatermarkSizeMode size_mode{WatermarkSizeMode::Auto};
     std::optional<WatermarkSize> force_size;  // Override auto-detection (for Auto/Small/Large)
     std::optional<cv::Rect> custom_region;    // Custom watermark region
+    EncodeProfile encode_profile{EncodeProfile::Max};  // Output encode profile (save + batch)
 };
 
 // =============================================================================
@@ -188,7 +213,8 @@ struct ProcessOptions {
 struct PreviewOptions {
     bool show_processed{false};     // Show processed instead of original
     bool highlight_watermark{true}; // Draw box around watermark region
-    bool split_view{false};         // Side-by-side comparison
+    bool split_view{false};         // Before/after split across the processed region
+    bool show_confidence_map{false};  // Custom mode: NCC heat map around the rect
 
     float zoom{1.0f};               // Zoom level (1.0 = fit to window)
     float pan_x{0.0f};              // Pan offset X
@@ -223,6 +249,19 @@ struct BatchFileResult {
     BatchFileStatus status{BatchFileStatus::Pending};
     float confidence{0.0f};         // Detection confidence
     std::string message;            // Status message
+
+    // Pre-scan (detection before anything is written)
+    bool scanned{false};            // confidence/detected come from the pre-scan
+    bool detected{false};           // Detector's own verdict
+    bool selected{true};            // Processed when the batch starts
+};
+
+/**
+ * Order of the batch grid and result list
+ */
+enum class BatchSortKey {
+    Name,           // File name, A-Z
+    Confidence      // Pre-scan confidence, highest first (unscanned last)
 };
 
 /**
@@ -240,16 +279,17 @@ struct BatchState {
     bool in_progress{false};
     bool cancel_requested{false};
 
+    // Pre-scan progress
+    size_t scan_done{0};                // Files scanned (or unreadable)
+    bool scan_in_progress{false};
+
     // Detection settings
     float detection_threshold{batch_theme::kDefaultThreshold};
     bool use_detection{true};           // Enable watermark detection
 
-    // Thumbnail atlas
-    TextureHandle thumbnail_texture;    // Combined atlas texture
-    int thumbnail_cols{0};              // Grid columns (set during generation)
-    int thumbnail_rows{0};              // Grid rows (set during generation)
-    int thumbnail_cell_size{batch_theme::kThumbnailCellSize};
-    bool thumbnails_ready{false};       // Atlas has been generated
+    // Thumbnails: a fixed pool of cells reused while scrolling
+    // (see AppController::request_thumbnails)
+    TextureHandle thumbnail_texture;    // Slot pool atlas
 
     // Confirmation dialog
     bool show_confirm_dialog{false};    // Show "overwrite files?" dialog
@@ -258,7 +298,8 @@ struct BatchState {
         files.clear();
         current_index = success_count = skip_count = fail_count = 0;
         in_progress = cancel_requested = false;
-        thumbnails_ready = false;
+        scan_done = 0;
+        scan_in_progress = false;
         show_confirm_dialog = false;
         // Note: detection_threshold and use_detection are NOT reset
         // Note: thumbnail_texture must be destroyed externally before clear
@@ -270,6 +311,10 @@ struct BatchState {
     }
 
     [[nodiscard]] size_t total() const noexcept { return files.size(); }
+    [[nodiscard]] size_t selected_count() const noexcept {
+        return static_cast<size_t>(std::count_if(files.begin(), files.end(),
+            [](const BatchFileResult& f) { return f.selected; }));
+    }
     [[nodiscard]] bool is_batch_mode() const noexcept { return !files.empty(); }
     [[nodiscard]] bool is_complete() const noexcept {
         return !files.empty() && !in_progress && current_index >= files.size();
@@ -289,6 +334,7 @@ struct AppState {
     ProcessState state{ProcessState::Idle};
     std::string status_message{"Ready"};
     std::string error_message;
+    float task_progress{0.0f};          // Background load/process progress (0-1)
 
     // Image
     ImageState image;
@@ -304,13 +350,15 @@ struct AppState {
     // Batch
     BatchState batch;
 
-    // Texture handle for preview
-    TextureHandle preview_texture;
+    // Texture handles for preview (the original is tiled, see AppController)
+    TextureHandle overlay_texture;      // Pixels of image.processed (drawn at its rect)
+    TextureHandle confidence_texture;   // Heat map of AppController::confidence_map()
     bool texture_needs_update{false};
 
     // UI state
     bool show_about_dialog{false};
     bool show_settings_dialog{false};
+    bool show_perf_overlay{false};      // Keeps frames flowing so the plots scroll
 
     // Display scaling
     float dpi_scale{1.0f};
@@ -329,6 +377,7 @@ struct AppState {
         state = ProcessState::Idle;
         status_message = "Ready";
         error_message.clear();
+        task_progress = 0.0f;
 
         image.clear();
         watermark_info.reset();
@@ -359,6 +408,13 @@ struct AppState {
     [[nodiscard]] bool can_save() const noexcept {
         return state == ProcessState::Completed && image.has_processed();
     }
+
+    /**
+     * Check if a background load/process is running
+     */
+    [[nodiscard]] bool is_busy() const noexcept {
+        return state == ProcessState::Loading || state == ProcessState::Processing;
+    }
 };
 
 }  // namespace gwt::gui
@@ -0,0 +1,64 @@
+/**
+ * @file    edit_history.cpp
+ * @brief   Undo/redo history implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#include "gui/app/edit_history.hpp"
+
+#include <spdlog/spdlog.h>
+
+namespace gwt::gui {
+
+EditHistory::EditHistory(size_t max_bytes)
+    : m_max_bytes(max_bytes)
+{
+}
+
+void EditHistory::push(EditStep step) {
+    // A new edit ends the redo branch
+    while (m_steps.size() > m_cursor) {
+        m_bytes -= m_steps.back().bytes();
+        m_steps.pop_back();
+    }
+
+    m_bytes += step.bytes();
+    m_steps.push_back(std::move(step));
+    m_cursor = m_steps.size();
+
+    trim();
+}
+
+const EditStep* EditHistory::undo() {
+    if (!can_undo()) return nullptr;
+    return &m_steps[--m_cursor];
+}
+
+const EditStep* EditHistory::redo() {
+    if (!can_redo()) return nullptr;
+    return &m_steps[m_cursor++];
+}
+
+void EditHistory::clear() {
+    m_steps.clear();
+    m_cursor = 0;
+    m_bytes = 0;
+}
+
+void EditHistory::trim() {
+    size_t dropped = 0;
+    while (m_bytes > m_max_bytes && m_steps.size() > 1) {
+        m_bytes -= m_steps.front().bytes();
+        m_steps.pop_front();
+        --m_cursor;
+        ++dropped;
+    }
+
+    if (dropped > 0) {
+        spdlog::debug("Edit history: dropped {} oldest steps ({} KiB held)",
+                      dropped, m_bytes / 1024);
+    }
+}
+
+}  // namespace gwt::gui
@@ -0,0 +1,103 @@
+/**
+ * @file    edit_history.hpp
+ * @brief   Undo/redo history for the single-image editor
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Every processing run is recorded as a step holding the processed patch
+ * and options before and after it. Patches only cover the watermark
+ * region, so undo/redo swaps a few KiB of pixels and re-uploads only the
+ * overlay texture; the original is never decoded again.
+ *
+ * The oldest steps are dropped once the history exceeds its byte budget.
+ */
+
+#pragma once
+
+#include "gui/app/app_state.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+
+namespace gwt::gui {
+
+/**
+ * Options that produced a patch (restored together with it)
+ */
+struct EditParams {
+    bool remove_mode{true};
+    WatermarkSizeMode size_mode{WatermarkSizeMode::Auto};
+    std::optional<WatermarkSize> force_size;
+    std::optional<cv::Rect> custom_region;     // Set for Custom size mode
+};
+
+/**
+ * Processed result plus the options it was made with
+ * (an empty patch means the unmodified original)
+ */
+struct EditSnapshot {
+    ImagePatch patch;
+    EditParams params;
+};
+
+struct EditStep {
+    EditSnapshot before;
+    EditSnapshot after;
+
+    [[nodiscard]] size_t bytes() const noexcept {
+        return before.patch.bytes() + after.patch.bytes();
+    }
+};
+
+class EditHistory {
+public:
+    static constexpr size_t kDefaultMaxBytes = 256ull * 1024 * 1024;
+
+    /**
+     * @param max_bytes  Pixel budget; oldest steps are dropped beyond it
+     */
+    explicit EditHistory(size_t max_bytes = kDefaultMaxBytes);
+
+    /**
+     * Record a step; discards anything that could be redone.
+     * The newest step is always kept, even if it alone exceeds the budget.
+     */
+    void push(EditStep step);
+
+    /**
+     * Step back
+     * @return Step to revert (restore its before), or nullptr
+     */
+    [[nodiscard]] const EditStep* undo();
+
+    /**
+     * Step forward again
+     * @return Step to re-apply (restore its after), or nullptr
+     */
+    [[nodiscard]] const EditStep* redo();
+
+    void clear();
+
+    [[nodiscard]] bool can_undo() const noexcept { return m_cursor > 0; }
+    [[nodiscard]] bool can_redo() const noexcept { return m_cursor < m_steps.size(); }
+    [[nodiscard]] size_t undo_count() const noexcept { return m_cursor; }
+    [[nodiscard]] size_t redo_count() const noexcept { return m_steps.size() - m_cursor; }
+
+    /**
+     * Pixel bytes held (an upper bound: a step's before usually shares
+     * its buffer with the previous step's after)
+     */
+    [[nodiscard]] size_t bytes() const noexcept { return m_bytes; }
+
+private:
+    std::deque<EditStep> m_steps;
+    size_t m_cursor{0};             // Steps [0, cursor) are applied
+    size_t m_bytes{0};
+    size_t m_max_bytes;
+
+    void trim();
+};
+
+}  // namespace gwt::gui
@@ -0,0 +1,309 @@
+/**
+ * @file    gui_benchmark.cpp
+ * @brief   Headless GUI benchmark implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#include "gui/app/gui_benchmark.hpp"
+#include "gui/app/app_controller.hpp"
+#include "gui/backend/null_backend.hpp"
+#include "gui/widgets/main_window.hpp"
+#include "gui/resources/style.hpp"
+#include "utils/path_formatter.hpp"
+
+#include <imgui.h>
+#include <implot.h>
+#include <spdlog/spdlog.h>
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gwt::gui {
+
+namespace {
+
+namespace fs = std::filesystem;
+using Clock = std::chrono::steady_clock;
+
+constexpr int kDefaultIterations = 50;                      // Preview toggles
+constexpr auto kFlowTimeout = std::chrono::seconds(300);
+constexpr auto kFrameWait = std::chrono::milliseconds(1);   // Longest wait for a worker result
+
+/**
+ * Worker wake-ups, so frames are not spun while waiting for results
+ */
+struct Waker {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool signaled{false};
+
+    void notify() {
+        {
+            std::lock_guard lock(mutex);
+            signaled = true;
+        }
+        cv.notify_one();
+    }
+
+    void wait() {
+        std::unique_lock lock(mutex);
+        cv.wait_for(lock, kFrameWait, [this] { return signaled; });
+        signaled = false;
+    }
+};
+
+struct Harness {
+    NullBackend& backend;
+    AppController& controller;
+    MainWindow& window;
+    Waker& waker;
+};
+
+struct Sample {
+    std::string name;
+    int runs{1};
+    double total_ms{0.0};
+    uint64_t frames{0};
+    uint64_t upload_calls{0};
+    uint64_t bytes_uploaded{0};
+};
+
+/**
+ * Benchmark inputs removed on scope exit
+ */
+struct TempDirectory {
+    fs::path path;
+
+    ~TempDirectory() {
+        if (path.empty()) return;
+        std::error_code ec;
+        fs::remove_all(path, ec);
+    }
+};
+
+void render_frame(Harness& h) {
+    h.backend.begin_frame();
+    h.backend.imgui_new_frame();
+    ImGui::NewFrame();
+    h.window.render();
+    ImGui::Render();
+    h.backend.imgui_render();
+    h.backend.end_frame();
+    h.backend.present();
+}
+
+/**
+ * Render frames until done() holds and the controller has settled
+ * (no background task, batch, or deferred tile upload left)
+ */
+bool run_until(Harness& h, const std::function<bool()>& done) {
+    const auto deadline = Clock::now() + kFlowTimeout;
+    for (;;) {
+        render_frame(h);
+        if (done() && !h.controller.wants_continuous_update()) return true;
+        if (Clock::now() > deadline) return false;
+        if (h.controller.state().is_busy() || h.controller.state().batch.in_progress ||
+            h.controller.thumbnails_loading()) {
+            h.waker.wait();
+        }
+    }
+}
+
+std::optional<Sample> measure(Harness& h, std::string name, int runs,
+                              const std::function<void()>& action,
+                              const std::function<bool()>& done) {
+    h.backend.reset_stats();
+    const auto start = Clock::now();
+
+    for (int i = 0; i < runs; ++i) {
+        action();
+        if (!run_until(h, done)) {
+            spdlog::error("Benchmark: '{}' timed out", name);
+            return std::nullopt;
+        }
+    }
+
+    Sample sample;
+    sample.name = std::move(name);
+    sample.runs = runs;
+    sample.total_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    sample.frames = h.backend.stats().frames;
+    sample.upload_calls = h.backend.stats().upload_calls;
+    sample.bytes_uploaded = h.backend.stats().bytes_uploaded;
+    return sample;
+}
+
+void print_report(const std::vector<Sample>& samples, const NullBackend& backend) {
+    fmt::print("\n{:<20} {:>6} {:>11} {:>11} {:>8} {:>8} {:>11}\n",
+               "flow", "runs", "total ms", "ms/run", "frames", "uploads", "upload MiB");
+    for (const auto& s : samples) {
+        fmt::print("{:<20} {:>6} {:>11.2f} {:>11.3f} {:>8} {:>8} {:>11.2f}\n",
+                   s.name, s.runs, s.total_ms, s.total_ms / s.runs, s.frames,
+                   s.upload_calls, static_cast<double>(s.bytes_uploaded) / (1024.0 * 1024.0));
+    }
+    fmt::print("\nresident textures: {} ({:.2f} MiB)\n\n", backend.texture_count(),
+               static_cast<double>(backend.resident_bytes()) / (1024.0 * 1024.0));
+}
+
+/**
+ * Copy batch inputs into a fresh temporary directory
+ */
+std::vector<fs::path> copy_inputs(const std::vector<fs::path>& files, TempDirectory& temp) {
+    temp.path = fs::temp_directory_path() /
+                fmt::format("gwt-gui-bench-{}", Clock::now().time_since_epoch().count());
+
+    std::error_code ec;
+    fs::create_directories(temp.path, ec);
+    if (ec) {
+        spdlog::error("Benchmark: cannot create {}: {}", temp.path, ec.message());
+        return {};
+    }
+
+    std::vector<fs::path> copies;
+    for (size_t i = 0; i < files.size(); ++i) {
+        fs::path target = temp.path / fmt::format("{:04}_{}", i, to_utf8(files[i].filename()));
+        if (!fs::copy_file(files[i], target, ec)) {
+            spdlog::error("Benchmark: cannot copy {}: {}", files[i], ec.message());
+            return {};
+        }
+        copies.push_back(std::move(target));
+    }
+    return copies;
+}
+
+}  // anonymous namespace
+
+bool is_gui_benchmark(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::string_view(argv[i]) == "--gui-bench") return true;
+    }
+    return false;
+}
+
+int run_gui_benchmark(int argc, char** argv) {
+    constexpr std::string_view kIterationsArg = "--bench-iterations=";
+
+    // Parse arguments
+    std::vector<fs::path> files;
+    int iterations = kDefaultIterations;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        if (arg.starts_with(kIterationsArg)) {
+            iterations = std::max(1, std::atoi(argv[i] + kIterationsArg.size()));
+        } else if (!arg.empty() && arg[0] != '-') {
+            fs::path path(argv[i]);
+            if (AppController::is_supported_extension(path) && fs::is_regular_file(path)) {
+                files.push_back(std::move(path));
+            } else {
+                spdlog::warn("Benchmark: skipping {}", path);
+            }
+        }
+    }
+
+    if (files.empty()) {
+        spdlog::error("Usage: --gui-bench <image> [more images...] [{}N]", kIterationsArg);
+        return 1;
+    }
+
+    // Headless backend and ImGui context
+    NullBackend backend;
+    if (!backend.init(nullptr)) {
+        spdlog::error("Failed to initialize backend: {}", to_string(backend.last_error()));
+        return 1;
+    }
+
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImPlot::CreateContext();
+    ImGui::GetIO().IniFilename = nullptr;
+    apply_style();
+    backend.imgui_init();
+
+    int exit_code = 1;
+    {
+        AppController controller(backend);
+        MainWindow main_window(controller);
+
+        Waker waker;
+        controller.set_wake_callback([&waker] { waker.notify(); });
+
+        Harness h{backend, controller, main_window, waker};
+        const AppState& state = controller.state();
+        std::vector<Sample> samples;
+
+        auto run = [&]() -> bool {
+            // Single image: load -> first complete preview
+            auto sample = measure(h, "load", 1,
+                [&] { controller.load_image(files.front()); },
+                [&] { return state.state != ProcessState::Loading; });
+            if (!sample || state.state != ProcessState::Loaded) {
+                spdlog::error("Benchmark: load failed: {}", state.error_message);
+                return false;
+            }
+            samples.push_back(std::move(*sample));
+
+            // Process -> processed overlay on screen
+            sample = measure(h, "process", 1,
+                [&] { controller.process_current(); },
+                [&] { return state.state != ProcessState::Processing; });
+            if (!sample || state.state != ProcessState::Completed) {
+                spdlog::error("Benchmark: process failed: {}", state.error_message);
+                return false;
+            }
+            samples.push_back(std::move(*sample));
+
+            // Before/after toggle: one frame each
+            sample = measure(h, "toggle_preview", iterations,
+                [&] { controller.toggle_preview(); },
+                [] { return true; });
+            if (!sample) return false;
+            samples.push_back(std::move(*sample));
+
+            // Batch on copies of all inputs
+            TempDirectory temp;
+            const std::vector<fs::path> copies = copy_inputs(files, temp);
+            if (copies.empty()) return false;
+
+            sample = measure(h, "batch_thumbnails", 1,
+                [&] { controller.enter_batch_mode(copies); },
+                [&] { return !controller.thumbnails_loading(); });
+            if (!sample || !state.batch.is_batch_mode()) return false;
+            samples.push_back(std::move(*sample));
+
+            sample = measure(h, "batch_process", 1,
+                [&] { controller.start_batch_processing(); },
+                [&] { return !state.batch.in_progress && !controller.thumbnails_loading(); });
+            if (!sample) return false;
+            samples.push_back(std::move(*sample));
+
+            spdlog::info("Batch: {} ok, {} skipped, {} failed",
+                         state.batch.success_count, state.batch.skip_count, state.batch.fail_count);
+
+            controller.exit_batch_mode();
+            return true;
+        };
+
+        if (run()) exit_code = 0;
+        print_report(samples, backend);
+    }
+
+    backend.imgui_shutdown();
+    ImPlot::DestroyContext();
+    ImGui::DestroyContext();
+    backend.shutdown();
+
+    return exit_code;
+}
+
+}  // namespace gwt::gui
@@ -0,0 +1,37 @@
+/**
+ * @file    gui_benchmark.hpp
+ * @brief   Headless GUI benchmark
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Drives AppController and MainWindow on the Null render backend, without
+ * a window or GPU, and reports the latency, frame count and texture upload
+ * volume of the main interactive flows:
+ *
+ *   gwt --gui-bench <image> [more images...] [--bench-iterations=N]
+ *
+ * The first image is loaded, processed and toggled; all images are then
+ * run as a batch on temporary copies (batch processing overwrites its
+ * inputs).
+ */
+
+#pragma once
+
+namespace gwt::gui {
+
+/**
+ * Check if the command line requests the benchmark (--gui-bench)
+ */
+[[nodiscard]] bool is_gui_benchmark(int argc, char** argv);
+
+/**
+ * Run the benchmark
+ *
+ * @param argc  Argument count
+ * @param argv  Argument values
+ * @return      Exit code (0 = all flows completed)
+ */
+int run_gui_benchmark(int argc, char** argv);
+
+}  // namespace gwt::gui
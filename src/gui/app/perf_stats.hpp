@@ -0,0 +1,102 @@
+/**
+ * @file    perf_stats.hpp
+ * @brief   Rolling performance counters for the GUI
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Recorded by AppController on the UI thread, plotted by PerfOverlay.
+ * Per-frame series are sampled every frame; per-event series (decode,
+ * processing, batch files) get one sample per completed task, so a slow
+ * frame can be attributed to decode, processing, upload or rendering.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace gwt::gui {
+
+/**
+ * Fixed-capacity (x, y) history; the oldest samples are overwritten.
+ * Plot with offset() so lines stay in order (ImPlot::PlotLine offset).
+ */
+class RollingSeries {
+public:
+    static constexpr size_t kDefaultCapacity = 2000;
+
+    explicit RollingSeries(size_t capacity = kDefaultCapacity)
+        : m_capacity(std::max<size_t>(capacity, 1))
+    {
+        m_x.reserve(m_capacity);
+        m_y.reserve(m_capacity);
+    }
+
+    void add(float x, float y) {
+        if (m_x.size() < m_capacity) {
+            m_x.push_back(x);
+            m_y.push_back(y);
+        } else {
+            m_x[m_offset] = x;
+            m_y[m_offset] = y;
+            m_offset = (m_offset + 1) % m_capacity;
+        }
+    }
+
+    void clear() {
+        m_x.clear();
+        m_y.clear();
+        m_offset = 0;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return m_x.empty(); }
+    [[nodiscard]] int size() const noexcept { return static_cast<int>(m_x.size()); }
+    [[nodiscard]] int offset() const noexcept { return static_cast<int>(m_offset); }
+    [[nodiscard]] const float* xs() const noexcept { return m_x.data(); }
+    [[nodiscard]] const float* ys() const noexcept { return m_y.data(); }
+
+    /**
+     * Most recent value (0 if empty)
+     */
+    [[nodiscard]] float last() const noexcept {
+        if (m_y.empty()) return 0.0f;
+        return m_y[(m_offset + m_y.size() - 1) % m_y.size()];
+    }
+
+    /**
+     * Largest value among samples with x >= since (0 if none)
+     */
+    [[nodiscard]] float max_since(float since) const noexcept {
+        float result = 0.0f;
+        for (size_t i = 0; i < m_x.size(); ++i) {
+            if (m_x[i] >= since) result = std::max(result, m_y[i]);
+        }
+        return result;
+    }
+
+private:
+    size_t m_capacity;
+    size_t m_offset{0};
+    std::vector<float> m_x;
+    std::vector<float> m_y;
+};
+
+/**
+ * All series share the x axis: seconds since the controller was created
+ */
+struct PerfStats {
+    // Per frame
+    RollingSeries frame_ms;         // Wall time between frames
+    RollingSeries texture_ms;       // Time in update_texture_if_needed()
+    RollingSeries upload_kib;       // Texel data sent to the GPU
+    RollingSeries queue_depth;      // Worker jobs queued or running
+
+    // Per completed task
+    RollingSeries decode_ms;        // Image load (decode + pyramid)
+    RollingSeries process_ms;       // Watermark processing
+    RollingSeries batch_file_ms;    // One batch file (decode + process + encode)
+};
+
+}  // namespace gwt::gui
@@ -0,0 +1,154 @@
+/**
+ * @file    prefetch_cache.cpp
+ * @brief   Neighbor image prefetch cache implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#include "gui/app/prefetch_cache.hpp"
+#include "utils/path_formatter.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace gwt::gui {
+
+namespace fs = std::filesystem;
+
+PrefetchCache::PrefetchCache(size_t max_bytes)
+    : m_max_bytes(max_bytes)
+{
+}
+
+// =============================================================================
+// Lookup
+// =============================================================================
+
+std::shared_ptr<const PrefetchedImage> PrefetchCache::find(const fs::path& path) {
+    const uint64_t stamp = file_stamp(path);
+
+    std::lock_guard lock(m_mutex);
+    auto it = locate(path);
+    if (it == m_entries.end()) return nullptr;
+
+    if (it->stamp != stamp) {
+        // Rewritten since it was decoded
+        m_bytes -= it->bytes;
+        m_entries.erase(it);
+        return nullptr;
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, it);
+    return it->image;
+}
+
+bool PrefetchCache::begin(const fs::path& path) {
+    const uint64_t stamp = file_stamp(path);
+
+    std::lock_guard lock(m_mutex);
+    if (m_in_flight.contains(path)) return false;
+
+    auto it = locate(path);
+    if (it != m_entries.end()) {
+        if (it->stamp == stamp) return false;
+        m_bytes -= it->bytes;
+        m_entries.erase(it);
+    }
+
+    m_in_flight.insert(path);
+    return true;
+}
+
+// =============================================================================
+// Update
+// =============================================================================
+
+void PrefetchCache::finish(const fs::path& path, std::shared_ptr<const PrefetchedImage> entry) {
+    {
+        std::lock_guard lock(m_mutex);
+        m_in_flight.erase(path);
+    }
+    if (entry) insert(path, std::move(entry));
+}
+
+void PrefetchCache::insert(const fs::path& path, std::shared_ptr<const PrefetchedImage> entry) {
+    if (!entry) return;
+
+    // Stamped after decoding: a file rewritten meanwhile misses next time
+    const uint64_t stamp = file_stamp(path);
+
+    std::lock_guard lock(m_mutex);
+    auto it = locate(path);
+    if (it != m_entries.end()) {
+        m_bytes -= it->bytes;
+        m_entries.erase(it);
+    }
+
+    const size_t bytes = entry->bytes();
+    m_entries.push_front(Entry{path, stamp, std::move(entry), bytes});
+    m_bytes += bytes;
+    evict();
+}
+
+void PrefetchCache::retain(std::span<const fs::path> keep) {
+    std::lock_guard lock(m_mutex);
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (std::find(keep.begin(), keep.end(), it->path) == keep.end()) {
+            m_bytes -= it->bytes;
+            it = m_entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void PrefetchCache::erase(const fs::path& path) {
+    std::lock_guard lock(m_mutex);
+    auto it = locate(path);
+    if (it != m_entries.end()) {
+        m_bytes -= it->bytes;
+        m_entries.erase(it);
+    }
+}
+
+void PrefetchCache::clear() {
+    std::lock_guard lock(m_mutex);
+    m_entries.clear();
+    m_bytes = 0;
+}
+
+size_t PrefetchCache::bytes() const {
+    std::lock_guard lock(m_mutex);
+    return m_bytes;
+}
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+uint64_t PrefetchCache::file_stamp(const fs::path& path) {
+    std::error_code ec;
+    const auto size = fs::file_size(path, ec);
+    if (ec) return 0;
+    const auto mtime = fs::last_write_time(path, ec).time_since_epoch().count();
+    if (ec) return 0;
+    return static_cast<uint64_t>(size) * 0x9e3779b97f4a7c15ull ^ static_cast<uint64_t>(mtime);
+}
+
+std::list<PrefetchCache::Entry>::iterator PrefetchCache::locate(const fs::path& path) {
+    return std::find_if(m_entries.begin(), m_entries.end(),
+                        [&](const Entry& e) { return e.path == path; });
+}
+
+void PrefetchCache::evict() {
+    // The newest entry stays even if it alone exceeds the budget
+    while (m_bytes > m_max_bytes && m_entries.size() > 1) {
+        const Entry& victim = m_entries.back();
+        spdlog::debug("Prefetch cache: evicting {} ({} KiB)", victim.path, victim.bytes / 1024);
+        m_bytes -= victim.bytes;
+        m_entries.pop_back();
+    }
+}
+
+}  // namespace gwt::gui
@@ -0,0 +1,124 @@
+/**
+ * @file    prefetch_cache.hpp
+ * @brief   In-memory cache of decoded neighbor images for folder browsing
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * While the user steps through a folder, workers decode the images around
+ * the current one (plus preview pyramid and watermark detection) into
+ * this cache, so Next/Previous can show them without waiting for a load.
+ *
+ *   - Entries are stamped with the file's size and mtime; a rewritten file
+ *     simply misses.
+ *   - The cache holds at most max_bytes of pixels; least recently used
+ *     entries are evicted beyond that.
+ *   - begin()/finish() track files being decoded so each is only
+ *     requested once.
+ *
+ * All methods are safe to call from worker threads.
+ */
+
+#pragma once
+
+#include "core/watermark_engine.hpp"
+
+#include <opencv2/core.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <span>
+#include <vector>
+
+namespace gwt::gui {
+
+/**
+ * Everything a load produces before the UI thread takes over
+ */
+struct PrefetchedImage {
+    cv::Mat image;                              // Decoded original (BGR)
+    std::vector<cv::Mat> pyramid;               // Preview mip levels of image
+    std::optional<DetectionResult> detection;   // Custom-mode detection
+    bool detection_run{false};                  // detection is valid
+
+    [[nodiscard]] size_t bytes() const noexcept {
+        size_t total = image.total() * image.elemSize();
+        for (const auto& level : pyramid) total += level.total() * level.elemSize();
+        return total;
+    }
+};
+
+class PrefetchCache {
+public:
+    static constexpr size_t kDefaultMaxBytes = 512ull * 1024 * 1024;
+
+    /**
+     * @param max_bytes  Pixel budget; least recently used entries are evicted beyond it
+     */
+    explicit PrefetchCache(size_t max_bytes = kDefaultMaxBytes);
+
+    PrefetchCache(const PrefetchCache&) = delete;
+    PrefetchCache& operator=(const PrefetchCache&) = delete;
+
+    /**
+     * Cached decode of the current contents of path (marks it recently used)
+     * @return nullptr on miss
+     */
+    [[nodiscard]] std::shared_ptr<const PrefetchedImage> find(const std::filesystem::path& path);
+
+    /**
+     * Mark path as being decoded
+     * @return false if it is already cached (and current) or in flight
+     */
+    [[nodiscard]] bool begin(const std::filesystem::path& path);
+
+    /**
+     * Store the decode started by begin() (nullptr if it failed)
+     */
+    void finish(const std::filesystem::path& path, std::shared_ptr<const PrefetchedImage> entry);
+
+    /**
+     * Store a decode made elsewhere (e.g. the image just loaded)
+     */
+    void insert(const std::filesystem::path& path, std::shared_ptr<const PrefetchedImage> entry);
+
+    /**
+     * Drop everything except the given files (in-flight decodes still land)
+     */
+    void retain(std::span<const std::filesystem::path> keep);
+
+    /**
+     * Drop the entry for path (call after rewriting it)
+     */
+    void erase(const std::filesystem::path& path);
+
+    void clear();
+
+    [[nodiscard]] size_t bytes() const;
+
+private:
+    struct Entry {
+        std::filesystem::path path;
+        uint64_t stamp{0};
+        std::shared_ptr<const PrefetchedImage> image;
+        size_t bytes{0};
+    };
+
+    mutable std::mutex m_mutex;
+    std::list<Entry> m_entries;                 // Most recently used first
+    std::set<std::filesystem::path> m_in_flight;
+    size_t m_bytes{0};
+    size_t m_max_bytes;
+
+    static uint64_t file_stamp(const std::filesystem::path& path);
+    std::list<Entry>::iterator locate(const std::filesystem::path& path);
+    void evict();
+};
+
+}  // namespace gwt::gui
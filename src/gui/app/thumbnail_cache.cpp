@@ -0,0 +1,264 @@
+/**
+ * @file    thumbnail_cache.cpp
+ * @brief   Persistent thumbnail cache implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#include "gui/app/thumbnail_cache.hpp"
+#include "utils/path_formatter.hpp"
+
+#include <opencv2/imgcodecs.hpp>
+#include <spdlog/spdlog.h>
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace gwt::gui {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr int kWebpQuality = 80;
+constexpr const char* kAppDirectory = "GeminiWatermarkTool";
+
+uint64_t fnv1a(std::string_view bytes, uint64_t hash = 0xcbf29ce484222325ull) {
+    for (unsigned char c : bytes) {
+        hash ^= c;
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+template <typename T>
+uint64_t fnv1a_value(const T& value, uint64_t hash) {
+    return fnv1a(std::string_view(reinterpret_cast<const char*>(&value), sizeof(value)), hash);
+}
+
+// Entry name suffix identifying the thumbnail size: "_<width>x<height>.webp"
+std::string size_suffix(cv::Size fit_size) {
+    return fmt::format("_{}x{}.webp", fit_size.width, fit_size.height);
+}
+
+fs::path env_path(const char* name) {
+#ifdef _WIN32
+    // Wide variant: the ANSI one mangles non-ASCII profile paths
+    std::wstring wname(name, name + std::char_traits<char>::length(name));
+    if (const wchar_t* value = _wgetenv(wname.c_str()); value && *value) {
+        return fs::path(value);
+    }
+#else
+    if (const char* value = std::getenv(name); value && *value) {
+        return fs::path(value);
+    }
+#endif
+    return {};
+}
+
+}  // anonymous namespace
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+ThumbnailCache::ThumbnailCache(fs::path directory, uint64_t max_bytes)
+    : m_directory(std::move(directory))
+    , m_max_bytes(max_bytes)
+{
+    if (m_directory.empty()) return;
+
+    std::error_code ec;
+    fs::create_directories(m_directory, ec);
+    m_enabled = !ec && fs::is_directory(m_directory, ec);
+
+    if (m_enabled) {
+        spdlog::debug("Thumbnail cache: {} (limit {} MiB)", m_directory, m_max_bytes >> 20);
+    } else {
+        spdlog::warn("Thumbnail cache disabled: cannot create {}", m_directory);
+    }
+}
+
+fs::path ThumbnailCache::default_directory() {
+    fs::path base;
+#if defined(_WIN32)
+    base = env_path("LOCALAPPDATA");
+#elif defined(__APPLE__)
+    if (auto home = env_path("HOME"); !home.empty()) {
+        base = home / "Library" / "Caches";
+    }
+#else
+    base = env_path("XDG_CACHE_HOME");
+    if (base.empty()) {
+        if (auto home = env_path("HOME"); !home.empty()) {
+            base = home / ".cache";
+        }
+    }
+#endif
+    if (base.empty()) return {};
+    return base / kAppDirectory / "thumbnails";
+}
+
+// =============================================================================
+// Lookup / Store
+// =============================================================================
+
+fs::path ThumbnailCache::source_directory(const fs::path& source) const {
+    std::error_code ec;
+    fs::path absolute = fs::absolute(source, ec);
+    if (ec) absolute = source;
+
+    const std::string key = to_utf8(absolute.lexically_normal());
+    return m_directory / fmt::format("{:016x}", fnv1a(key));
+}
+
+fs::path ThumbnailCache::entry_path(const fs::path& source, cv::Size fit_size) const {
+    std::error_code ec;
+    const auto size = fs::file_size(source, ec);
+    if (ec) return {};
+    const auto mtime = fs::last_write_time(source, ec).time_since_epoch().count();
+    if (ec) return {};
+
+    uint64_t stamp = fnv1a_value(static_cast<uint64_t>(size), 0xcbf29ce484222325ull);
+    stamp = fnv1a_value(static_cast<int64_t>(mtime), stamp);
+
+    return source_directory(source) / fmt::format("{:016x}{}", stamp, size_suffix(fit_size));
+}
+
+cv::Mat ThumbnailCache::load(const fs::path& source, cv::Size fit_size) {
+    if (!m_enabled) return {};
+
+    const fs::path entry = entry_path(source, fit_size);
+    std::error_code ec;
+    if (entry.empty() || !fs::is_regular_file(entry, ec)) return {};
+
+    cv::Mat thumbnail = cv::imread(entry.string(), cv::IMREAD_COLOR);
+    if (thumbnail.empty()) {
+        fs::remove(entry, ec);  // Corrupt entry
+        return {};
+    }
+
+    // Mark as recently used
+    fs::last_write_time(entry, fs::file_time_type::clock::now(), ec);
+    return thumbnail;
+}
+
+void ThumbnailCache::store(const fs::path& source, cv::Size fit_size, const cv::Mat& thumbnail) {
+    if (!m_enabled || thumbnail.empty()) return;
+
+    const fs::path entry = entry_path(source, fit_size);
+    if (entry.empty()) return;
+
+    std::vector<uint8_t> buffer;
+    if (!cv::imencode(".webp", thumbnail, buffer, {cv::IMWRITE_WEBP_QUALITY, kWebpQuality})) {
+        return;
+    }
+
+    std::error_code ec;
+    const fs::path dir = entry.parent_path();
+    fs::create_directories(dir, ec);
+    if (ec) return;
+
+    // Drop older versions of this source at the same size; other sizes stay,
+    // and *.tmp files may be another thread's write in progress
+    const std::string suffix = size_suffix(fit_size);
+    for (const auto& e : fs::directory_iterator(dir, ec)) {
+        const fs::path& path = e.path();
+        if (path == entry || path.extension() == ".tmp") continue;
+        if (path.filename().string().ends_with(suffix)) fs::remove(path, ec);
+    }
+
+    // Write to a temporary name and rename, so readers never see partial files
+    const fs::path temp = dir / fmt::format("{}.{:x}.tmp", entry.filename().string(),
+                                            std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+        std::ofstream file(temp, std::ios::binary);
+        if (!file) return;
+        file.write(reinterpret_cast<const char*>(buffer.data()),
+                   static_cast<std::streamsize>(buffer.size()));
+        if (!file) {
+            file.close();
+            fs::remove(temp, ec);
+            return;
+        }
+    }
+    fs::rename(temp, entry, ec);
+    if (ec) {
+        fs::remove(temp, ec);
+        return;
+    }
+
+    // Trim once roughly an eighth of the budget has been written
+    if (m_bytes_since_evict.fetch_add(buffer.size()) + buffer.size() > m_max_bytes / 8) {
+        evict();
+    }
+}
+
+void ThumbnailCache::invalidate(const fs::path& source) {
+    if (!m_enabled) return;
+
+    std::error_code ec;
+    fs::remove_all(source_directory(source), ec);
+}
+
+// =============================================================================
+// Eviction
+// =============================================================================
+
+void ThumbnailCache::evict() {
+    if (!m_enabled) return;
+
+    std::lock_guard lock(m_evict_mutex);
+    m_bytes_since_evict = 0;
+
+    struct Entry {
+        fs::path path;
+        uint64_t size;
+        fs::file_time_type mtime;
+    };
+
+    std::vector<Entry> entries;
+    uint64_t total = 0;
+
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(m_directory, ec);
+         !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+        std::error_code entry_ec;
+        if (!it->is_regular_file(entry_ec)) continue;
+        Entry e{it->path(), it->file_size(entry_ec), it->last_write_time(entry_ec)};
+        if (entry_ec) continue;
+        total += e.size;
+        entries.push_back(std::move(e));
+    }
+
+    if (total <= m_max_bytes) return;
+
+    // Oldest first; trim to 90% so the next few stores don't trigger another scan
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) { return a.mtime < b.mtime; });
+
+    const uint64_t target = m_max_bytes - m_max_bytes / 10;
+    size_t removed = 0;
+    for (const auto& e : entries) {
+        if (total <= target) break;
+        if (fs::remove(e.path, ec)) {
+            total -= e.size;
+            ++removed;
+            // Remove the per-source directory once it is empty
+            if (e.path.parent_path() != m_directory) {
+                fs::remove(e.path.parent_path(), ec);
+            }
+        }
+    }
+
+    spdlog::debug("Thumbnail cache: evicted {} entries ({} MiB remaining)", removed, total >> 20);
+}
+
+}  // namespace gwt::gui
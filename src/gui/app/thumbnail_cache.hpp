@@ -0,0 +1,93 @@
+/**
+ * @file    thumbnail_cache.hpp
+ * @brief   Persistent on-disk cache of batch thumbnails
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Thumbnails are stored as small lossy WebP files in the user cache
+ * directory, so re-opening the same working folder skips decoding the
+ * originals entirely.
+ *
+ * Entry: <hash(path)>/<hash(file size, mtime)>_<width>x<height>.webp
+ *   - A rewritten source gets a new stamp and simply misses; the stale
+ *     entry is removed by the next store of the same thumbnail size or by
+ *     invalidate(), which only touch that source's own subdirectory.
+ *   - Hits refresh the entry's mtime, which drives LRU eviction once the
+ *     directory exceeds its byte budget.
+ *
+ * All methods are safe to call from worker threads.
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+
+namespace gwt::gui {
+
+class ThumbnailCache {
+public:
+    static constexpr uint64_t kDefaultMaxBytes = 256ull * 1024 * 1024;
+
+    /**
+     * @param directory  Cache directory (created on demand)
+     * @param max_bytes  Size budget; oldest entries are evicted beyond it
+     */
+    explicit ThumbnailCache(std::filesystem::path directory,
+                            uint64_t max_bytes = kDefaultMaxBytes);
+
+    ThumbnailCache(const ThumbnailCache&) = delete;
+    ThumbnailCache& operator=(const ThumbnailCache&) = delete;
+
+    /**
+     * Platform cache location:
+     *   Windows: %LOCALAPPDATA%/GeminiWatermarkTool/thumbnails
+     *   macOS:   ~/Library/Caches/GeminiWatermarkTool/thumbnails
+     *   Linux:   $XDG_CACHE_HOME (or ~/.cache)/GeminiWatermarkTool/thumbnails
+     * Empty if no suitable base directory is known.
+     */
+    [[nodiscard]] static std::filesystem::path default_directory();
+
+    /**
+     * Look up a thumbnail for the current contents of source
+     * @return BGR thumbnail, or empty on miss
+     */
+    [[nodiscard]] cv::Mat load(const std::filesystem::path& source, cv::Size fit_size);
+
+    /**
+     * Store a thumbnail for the current contents of source
+     */
+    void store(const std::filesystem::path& source, cv::Size fit_size, const cv::Mat& thumbnail);
+
+    /**
+     * Remove all entries for source (call after rewriting it)
+     */
+    void invalidate(const std::filesystem::path& source);
+
+    /**
+     * Delete least recently used entries until under the byte budget
+     */
+    void evict();
+
+    [[nodiscard]] bool enabled() const noexcept { return m_enabled; }
+    [[nodiscard]] const std::filesystem::path& directory() const noexcept { return m_directory; }
+
+private:
+    [[nodiscard]] std::filesystem::path source_directory(const std::filesystem::path& source) const;
+    [[nodiscard]] std::filesystem::path entry_path(const std::filesystem::path& source,
+                                                   cv::Size fit_size) const;
+
+    std::filesystem::path m_directory;
+    uint64_t m_max_bytes;
+    bool m_enabled{false};
+
+    std::mutex m_evict_mutex;                   // Serializes directory scans
+    std::atomic<uint64_t> m_bytes_since_evict{0};
+};
+
+}  // namespace gwt::gui
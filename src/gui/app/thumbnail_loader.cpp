@@ -0,0 +1,62 @@
+/**
+ * @file    thumbnail_loader.cpp
+ * @brief   Reduced-resolution thumbnail decoding implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#include "gui/app/thumbnail_loader.hpp"
+#include "core/image_codec.hpp"
+#include "core/jpeg_info.hpp"
+
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+
+namespace gwt::gui {
+
+int reduced_decode_flag(cv::Size src_size, cv::Size fit_size) {
+    if (src_size.width <= 0 || src_size.height <= 0 ||
+        fit_size.width <= 0 || fit_size.height <= 0) {
+        return cv::IMREAD_COLOR;
+    }
+
+    // Fit scale for either orientation (EXIF rotation is applied after decode)
+    const double sw = static_cast<double>(fit_size.width);
+    const double sh = static_cast<double>(fit_size.height);
+    const double w = static_cast<double>(src_size.width);
+    const double h = static_cast<double>(src_size.height);
+    const double scale = std::max(std::min(sw / w, sh / h), std::min(sw / h, sh / w));
+
+    // Largest power-of-two reduction that keeps the fitted size
+    if (scale * 8.0 <= 1.0) return cv::IMREAD_REDUCED_COLOR_8;
+    if (scale * 4.0 <= 1.0) return cv::IMREAD_REDUCED_COLOR_4;
+    if (scale * 2.0 <= 1.0) return cv::IMREAD_REDUCED_COLOR_2;
+    return cv::IMREAD_COLOR;
+}
+
+cv::Mat load_thumbnail(const std::filesystem::path& path, cv::Size fit_size) {
+    int flag = cv::IMREAD_COLOR;
+    if (format_from_path(path) == ImageFormat::Jpeg) {
+        if (auto info = read_jpeg_info(path)) {
+            flag = reduced_decode_flag(cv::Size(info->width, info->height), fit_size);
+        }
+    }
+
+    cv::Mat image = cv::imread(path.string(), flag);
+    if (image.empty()) return {};
+
+    const float scale = std::min(
+        static_cast<float>(fit_size.width) / image.cols,
+        static_cast<float>(fit_size.height) / image.rows
+    );
+    const int tw = std::max(1, static_cast<int>(image.cols * scale));
+    const int th = std::max(1, static_cast<int>(image.rows * scale));
+
+    cv::Mat thumb;
+    cv::resize(image, thumb, cv::Size(tw, th), 0, 0, cv::INTER_AREA);
+    return thumb;
+}
+
+}  // namespace gwt::gui
@@ -0,0 +1,40 @@
+/**
+ * @file    thumbnail_loader.hpp
+ * @brief   Reduced-resolution image decoding for batch thumbnails
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Batch thumbnails are ~200px; decoding a 50 MP JPEG at full size to
+ * throw away 99.9% of the pixels dominates atlas generation. For JPEG
+ * input the header is parsed first and the largest libjpeg DCT scale
+ * (1/2, 1/4, 1/8 via IMREAD_REDUCED_COLOR_*) that still covers the
+ * thumbnail is used. Other formats are decoded normally.
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include <filesystem>
+
+namespace gwt::gui {
+
+/**
+ * Pick the IMREAD flag for decoding an image of src_size so that the
+ * result still covers a thumbnail fitted into fit_size
+ *
+ * @return cv::IMREAD_COLOR or one of cv::IMREAD_REDUCED_COLOR_{2,4,8}
+ */
+[[nodiscard]] int reduced_decode_flag(cv::Size src_size, cv::Size fit_size);
+
+/**
+ * Decode an image and downscale it to fit within fit_size (aspect preserved)
+ *
+ * @param path      Image file
+ * @param fit_size  Bounding box of the thumbnail
+ * @return          BGR thumbnail, or empty on failure
+ */
+[[nodiscard]] cv::Mat load_thumbnail(const std::filesystem::path& path, cv::Size fit_size);
+
+}  // namespace gwt::gui
@@ -0,0 +1,84 @@
+/**
+ * @file    worker_pool.cpp
+ * @brief   Background worker threads implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#include "gui/app/worker_pool.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <exception>
+
+namespace gwt::gui {
+
+WorkerPool::WorkerPool(unsigned thread_count) {
+    if (thread_count == 0) {
+        // Leave one hardware thread for the UI
+        const unsigned hw = std::thread::hardware_concurrency();
+        thread_count = std::max(1u, hw > 1 ? hw - 1 : 1u);
+    }
+
+    m_threads.reserve(thread_count);
+    for (unsigned i = 0; i < thread_count; ++i) {
+        m_threads.emplace_back([this] { worker_loop(); });
+    }
+
+    spdlog::debug("WorkerPool started: {} threads", thread_count);
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+        m_jobs.clear();
+    }
+    m_cv.notify_all();
+
+    for (auto& t : m_threads) {
+        if (t.joinable()) t.join();
+    }
+}
+
+void WorkerPool::submit(Job job) {
+    {
+        std::lock_guard lock(m_mutex);
+        m_jobs.push_back(std::move(job));
+    }
+    m_cv.notify_one();
+}
+
+size_t WorkerPool::pending() const {
+    std::lock_guard lock(m_mutex);
+    return m_jobs.size() + m_running;
+}
+
+void WorkerPool::worker_loop() {
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock lock(m_mutex);
+            m_cv.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+            if (m_stopping) return;
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+            ++m_running;
+        }
+
+        try {
+            job();
+        } catch (const std::exception& e) {
+            spdlog::error("Worker job failed: {}", e.what());
+        } catch (...) {
+            spdlog::error("Worker job failed: unknown exception");
+        }
+
+        std::lock_guard lock(m_mutex);
+        --m_running;
+    }
+}
+
+}  // namespace gwt::gui
@@ -0,0 +1,67 @@
+/**
+ * @file    worker_pool.hpp
+ * @brief   Background worker threads for the GUI
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Fixed set of threads that run jobs submitted by the UI thread, so that
+ * decode/process/encode work never runs inside a frame. Jobs report back
+ * by pushing into an MpmcQueue that the UI drains once per frame; the pool
+ * itself knows nothing about results.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gwt::gui {
+
+class WorkerPool {
+public:
+    using Job = std::function<void()>;
+
+    /**
+     * @param thread_count  Number of threads (0 = hardware threads - 1, min 1)
+     */
+    explicit WorkerPool(unsigned thread_count = 0);
+
+    /**
+     * Drops jobs that have not started and joins all threads
+     */
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * Queue a job (FIFO)
+     */
+    void submit(Job job);
+
+    [[nodiscard]] unsigned thread_count() const noexcept {
+        return static_cast<unsigned>(m_threads.size());
+    }
+
+    /**
+     * Jobs submitted but not finished (queued + running)
+     */
+    [[nodiscard]] size_t pending() const;
+
+private:
+    void worker_loop();
+
+    std::vector<std::thread> m_threads;
+    std::deque<Job> m_jobs;
+    size_t m_running{0};
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stopping{false};
+};
+
+}  // namespace gwt::gui
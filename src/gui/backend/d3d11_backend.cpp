@@ -551,6 +551,8 @@ D3D11Backend::create_texture(const TextureDesc& desc, std::span<const uint8_t> d
         return TextureHandle{};
     }
 
+    if (pixel_data) note_upload(static_cast<uint64_t>(row_pitch) * desc.height);
+
     // Generate mipmaps if requested
     if (desc.generate_mips && pixel_data) {
         m_context->GenerateMips(srv.get());
@@ -616,6 +618,61 @@ void D3D11Backend::update_texture(TextureHandle handle, std::span<const uint8_t>
         tex.desc.width * 4,  // Always RGBA
         0
     );
+    note_upload(static_cast<uint64_t>(tex.desc.width) * tex.desc.height * 4);
+}
+
+void D3D11Backend::update_texture_region(TextureHandle handle, const TextureRect& rect,
+                                         std::span<const uint8_t> data, size_t stride) {
+    auto it = m_textures.find(handle.id);
+    if (it == m_textures.end()) {
+        spdlog::warn("D3D11: Attempted to update invalid texture handle: {}", handle.id);
+        return;
+    }
+
+    auto& tex = it->second;
+    if (!validate_region(tex.desc, rect, data, stride)) return;
+
+    // Convert RGB rows to RGBA if needed (texture is always 4 bytes/pixel)
+    std::vector<uint8_t> rgba_data;
+    const uint8_t* pixel_data = data.data();
+    UINT row_pitch = static_cast<UINT>(stride);
+
+    if (tex.desc.format == TextureFormat::RGB8 || tex.desc.format == TextureFormat::BGR8) {
+        rgba_data.resize(static_cast<size_t>(rect.width) * rect.height * 4);
+        uint8_t* dst = rgba_data.data();
+
+        for (uint32_t y = 0; y < rect.height; ++y) {
+            const uint8_t* src = data.data() + y * stride;
+            for (uint32_t x = 0; x < rect.width; ++x) {
+                dst[0] = src[0];
+                dst[1] = src[1];
+                dst[2] = src[2];
+                dst[3] = 255;
+                src += 3;
+                dst += 4;
+            }
+        }
+        pixel_data = rgba_data.data();
+        row_pitch = rect.width * 4;
+    }
+
+    D3D11_BOX box = {};
+    box.left = rect.x;
+    box.top = rect.y;
+    box.front = 0;
+    box.right = rect.x + rect.width;
+    box.bottom = rect.y + rect.height;
+    box.back = 1;
+
+    m_context->UpdateSubresource(
+        tex.texture.get(),
+        0,
+        &box,
+        pixel_data,
+        row_pitch,
+        0
+    );
+    note_upload(static_cast<uint64_t>(rect.width) * rect.height * 4);
 }
 
 void D3D11Backend::destroy_texture(TextureHandle handle) {
@@ -638,6 +695,11 @@ void* D3D11Backend::get_imgui_texture_id(TextureHandle handle) const {
     return it->second.srv.get();
 }
 
+const TextureDesc* D3D11Backend::texture_desc(TextureHandle handle) const {
+    auto it = m_textures.find(handle.id);
+    return it == m_textures.end() ? nullptr : &it->second.desc;
+}
+
 // =============================================================================
 // Backend Info
 // =============================================================================
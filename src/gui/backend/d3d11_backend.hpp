@@ -77,9 +77,12 @@ public:
     create_texture(const TextureDesc& desc, std::span<const uint8_t> data = {}) override;
     
     void update_texture(TextureHandle handle, std::span<const uint8_t> data) override;
+    void update_texture_region(TextureHandle handle, const TextureRect& rect,
+                               std::span<const uint8_t> data, size_t stride = 0) override;
     void destroy_texture(TextureHandle handle) override;
     
     [[nodiscard]] void* get_imgui_texture_id(TextureHandle handle) const override;
+    [[nodiscard]] const TextureDesc* texture_desc(TextureHandle handle) const override;
 
     // ==========================================================================
     // Backend Info
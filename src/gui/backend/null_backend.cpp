@@ -0,0 +1,276 @@
+/**
+ * @file    null_backend.cpp
+ * @brief   Null Render Backend Implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#include "gui/backend/null_backend.hpp"
+
+#include <SDL3/SDL.h>
+#include <imgui.h>
+#include <imgui_impl_sdl3.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace gwt::gui {
+
+namespace {
+
+// Display size reported to ImGui when there is no window
+constexpr int kHeadlessWidth = 1600;
+constexpr int kHeadlessHeight = 1250;
+
+}  // anonymous namespace
+
+NullBackend::~NullBackend() {
+    shutdown();
+}
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+bool NullBackend::init(SDL_Window* window) {
+    if (m_initialized) return true;
+
+    m_window = window;
+    if (m_window) {
+        SDL_GetWindowSizeInPixels(m_window, &m_width, &m_height);
+    } else {
+        m_width = kHeadlessWidth;
+        m_height = kHeadlessHeight;
+    }
+
+    spdlog::info("Null backend initialized ({}, {}x{})",
+                 m_window ? "windowed" : "headless", m_width, m_height);
+
+    m_initialized = true;
+    clear_error();
+    return true;
+}
+
+void NullBackend::shutdown() {
+    if (!m_initialized) return;
+
+    if (!m_textures.empty()) {
+        spdlog::debug("Null backend: releasing {} textures", m_textures.size());
+    }
+    m_textures.clear();
+
+    m_window = nullptr;
+    m_initialized = false;
+}
+
+// =============================================================================
+// ImGui Integration
+// =============================================================================
+
+void NullBackend::imgui_init() {
+    if (!m_initialized) return;
+
+    if (m_window) {
+        ImGui_ImplSDL3_InitForOther(m_window);
+    }
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendRendererName = "gwt_null";
+    if (!io.Fonts->IsBuilt()) {
+        io.Fonts->Build();  // Nothing uploads the atlas, but NewFrame() requires it
+    }
+
+    m_last_frame = std::chrono::steady_clock::now();
+    m_imgui_initialized = true;
+}
+
+void NullBackend::imgui_shutdown() {
+    if (!m_imgui_initialized) return;
+
+    if (m_window) {
+        ImGui_ImplSDL3_Shutdown();
+    }
+    ImGui::GetIO().BackendRendererName = nullptr;
+    m_imgui_initialized = false;
+}
+
+void NullBackend::imgui_new_frame() {
+    if (m_window) {
+        ImGui_ImplSDL3_NewFrame();
+        return;
+    }
+
+    // Headless: what the platform backend would otherwise provide
+    const auto now = std::chrono::steady_clock::now();
+    const float dt = std::chrono::duration<float>(now - m_last_frame).count();
+    m_last_frame = now;
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(static_cast<float>(m_width), static_cast<float>(m_height));
+    io.DeltaTime = dt > 0.0f ? dt : 1.0f / 60.0f;
+}
+
+void NullBackend::imgui_render() {
+    // Draw data is discarded
+}
+
+// =============================================================================
+// Frame Management
+// =============================================================================
+
+void NullBackend::begin_frame() {
+    if (m_window) {
+        SDL_GetWindowSizeInPixels(m_window, &m_width, &m_height);
+    }
+}
+
+void NullBackend::end_frame() {
+    ++m_stats.frames;
+}
+
+void NullBackend::present() {
+}
+
+void NullBackend::on_resize(int width, int height) {
+    m_width = width;
+    m_height = height;
+}
+
+// =============================================================================
+// Texture Operations
+// =============================================================================
+
+TextureHandle NullBackend::create_texture(const TextureDesc& desc, std::span<const uint8_t> data) {
+    if (desc.width == 0 || desc.height == 0) {
+        set_error(BackendError::TextureCreationFailed);
+        return TextureHandle{};
+    }
+
+    TextureData tex;
+    tex.desc = desc;
+    tex.pixels.resize(static_cast<size_t>(desc.width) * desc.height * bytes_per_pixel(desc.format));
+
+    if (!data.empty()) {
+        const size_t bytes = std::min(data.size(), tex.pixels.size());
+        std::memcpy(tex.pixels.data(), data.data(), bytes);
+        ++m_stats.upload_calls;
+        m_stats.bytes_uploaded += bytes;
+        note_upload(bytes);
+    }
+
+    const uint64_t id = m_next_handle_id++;
+    m_textures.emplace(id, std::move(tex));
+    ++m_stats.textures_created;
+
+    clear_error();
+    return TextureHandle{id};
+}
+
+void NullBackend::update_texture(TextureHandle handle, std::span<const uint8_t> data) {
+    const TextureDesc* desc = texture_desc(handle);
+    if (!desc) return;
+    update_texture_region(handle, TextureRect{0, 0, desc->width, desc->height}, data);
+}
+
+void NullBackend::update_texture_region(TextureHandle handle, const TextureRect& rect,
+                                        std::span<const uint8_t> data, size_t stride) {
+    auto it = m_textures.find(handle.id);
+    if (it == m_textures.end()) return;
+
+    TextureData& tex = it->second;
+    if (!validate_region(tex.desc, rect, data, stride)) {
+        set_error(BackendError::TextureUpdateFailed);
+        return;
+    }
+
+    const size_t bpp = bytes_per_pixel(tex.desc.format);
+    const size_t row_bytes = static_cast<size_t>(rect.width) * bpp;
+    const size_t dst_stride = static_cast<size_t>(tex.desc.width) * bpp;
+
+    uint8_t* dst = tex.pixels.data() + rect.y * dst_stride + rect.x * bpp;
+    for (uint32_t y = 0; y < rect.height; ++y) {
+        std::memcpy(dst + y * dst_stride, data.data() + y * stride, row_bytes);
+    }
+
+    ++m_stats.upload_calls;
+    m_stats.bytes_uploaded += row_bytes * rect.height;
+    note_upload(row_bytes * rect.height);
+}
+
+void NullBackend::destroy_texture(TextureHandle handle) {
+    if (m_textures.erase(handle.id) > 0) {
+        ++m_stats.textures_destroyed;
+    }
+}
+
+TextureUpload NullBackend::map_texture_region(TextureHandle handle, const TextureRect& rect) {
+    auto it = m_textures.find(handle.id);
+    if (it == m_textures.end()) return TextureUpload{};
+
+    TextureData& tex = it->second;
+    if (rect.empty() ||
+        rect.x + rect.width > tex.desc.width || rect.y + rect.height > tex.desc.height) {
+        return TextureUpload{};
+    }
+
+    // Written in place: the "upload" is the caller's conversion
+    const size_t bpp = bytes_per_pixel(tex.desc.format);
+
+    TextureUpload upload;
+    upload.handle = handle;
+    upload.rect = rect;
+    upload.stride = static_cast<size_t>(tex.desc.width) * bpp;
+    upload.data = tex.pixels.data() + rect.y * upload.stride + rect.x * bpp;
+    return upload;
+}
+
+void NullBackend::commit_texture_region(const TextureUpload& upload) {
+    if (!upload.valid() || !m_textures.contains(upload.handle.id)) return;
+
+    const TextureDesc& desc = m_textures.at(upload.handle.id).desc;
+    const uint64_t bytes =
+        static_cast<uint64_t>(upload.rect.width) * upload.rect.height * bytes_per_pixel(desc.format);
+    ++m_stats.upload_calls;
+    m_stats.bytes_uploaded += bytes;
+    note_upload(bytes);
+}
+
+void* NullBackend::get_imgui_texture_id(TextureHandle handle) const {
+    auto it = m_textures.find(handle.id);
+    if (it == m_textures.end()) return nullptr;
+    return const_cast<uint8_t*>(it->second.pixels.data());
+}
+
+const TextureDesc* NullBackend::texture_desc(TextureHandle handle) const {
+    auto it = m_textures.find(handle.id);
+    return it != m_textures.end() ? &it->second.desc : nullptr;
+}
+
+// =============================================================================
+// Backend Info
+// =============================================================================
+
+std::string_view NullBackend::name() const noexcept {
+    return "Null";
+}
+
+// =============================================================================
+// Statistics
+// =============================================================================
+
+size_t NullBackend::resident_bytes() const noexcept {
+    size_t total = 0;
+    for (const auto& [id, tex] : m_textures) {
+        total += tex.pixels.size();
+    }
+    return total;
+}
+
+std::span<const uint8_t> NullBackend::texture_pixels(TextureHandle handle) const {
+    auto it = m_textures.find(handle.id);
+    if (it == m_textures.end()) return {};
+    return it->second.pixels;
+}
+
+}  // namespace gwt::gui
@@ -0,0 +1,140 @@
+/**
+ * @file    null_backend.hpp
+ * @brief   Null Render Backend (headless)
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Keeps textures in system memory and renders nothing. Needs no window
+ * or GPU, so the GUI controller and texture paths can be driven on plain
+ * build machines (see gui_benchmark.hpp). Counts texture calls and bytes
+ * uploaded, which is what the GPU backends would have transferred.
+ */
+
+#pragma once
+
+#include "gui/backend/render_backend.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Forward declarations
+struct SDL_Window;
+
+namespace gwt::gui {
+
+class NullBackend final : public IRenderBackend {
+public:
+    /**
+     * Work counters since creation or the last reset_stats()
+     */
+    struct Stats {
+        uint64_t textures_created{0};
+        uint64_t textures_destroyed{0};
+        uint64_t upload_calls{0};       // create (with data), update and commit calls
+        uint64_t bytes_uploaded{0};
+        uint64_t frames{0};             // end_frame() calls
+    };
+
+    NullBackend() = default;
+    ~NullBackend() override;
+
+    // ==========================================================================
+    // Lifecycle
+    // ==========================================================================
+
+    /**
+     * @param window  SDL window for ImGui input, or nullptr when headless
+     */
+    [[nodiscard]] bool init(SDL_Window* window) override;
+
+    void shutdown() override;
+
+    // ==========================================================================
+    // ImGui Integration
+    // ==========================================================================
+
+    void imgui_init() override;
+    void imgui_shutdown() override;
+    void imgui_new_frame() override;
+    void imgui_render() override;
+
+    // ==========================================================================
+    // Frame Management
+    // ==========================================================================
+
+    void begin_frame() override;
+    void end_frame() override;
+    void present() override;
+    void on_resize(int width, int height) override;
+
+    // ==========================================================================
+    // Texture Operations
+    // ==========================================================================
+
+    [[nodiscard]] TextureHandle
+    create_texture(const TextureDesc& desc, std::span<const uint8_t> data = {}) override;
+
+    void update_texture(TextureHandle handle, std::span<const uint8_t> data) override;
+    void update_texture_region(TextureHandle handle, const TextureRect& rect,
+                               std::span<const uint8_t> data, size_t stride = 0) override;
+    void destroy_texture(TextureHandle handle) override;
+
+    [[nodiscard]] TextureUpload map_texture_region(TextureHandle handle,
+                                                   const TextureRect& rect) override;
+    void commit_texture_region(const TextureUpload& upload) override;
+
+    /**
+     * Returns the texture's pixel storage (never nullptr for a live texture)
+     */
+    [[nodiscard]] void* get_imgui_texture_id(TextureHandle handle) const override;
+    [[nodiscard]] const TextureDesc* texture_desc(TextureHandle handle) const override;
+
+    // ==========================================================================
+    // Backend Info
+    // ==========================================================================
+
+    [[nodiscard]] std::string_view name() const noexcept override;
+    [[nodiscard]] BackendType type() const noexcept override { return BackendType::Null; }
+    [[nodiscard]] bool supports_compute() const noexcept override { return false; }
+
+    // ==========================================================================
+    // Statistics
+    // ==========================================================================
+
+    [[nodiscard]] const Stats& stats() const noexcept { return m_stats; }
+    void reset_stats() noexcept { m_stats = Stats{}; }
+
+    [[nodiscard]] size_t texture_count() const noexcept { return m_textures.size(); }
+
+    /**
+     * Bytes currently held by textures (what would be resident in VRAM)
+     */
+    [[nodiscard]] size_t resident_bytes() const noexcept;
+
+    /**
+     * Pixel storage of a texture, rows packed (empty if handle is invalid)
+     */
+    [[nodiscard]] std::span<const uint8_t> texture_pixels(TextureHandle handle) const;
+
+private:
+    struct TextureData {
+        TextureDesc desc;
+        std::vector<uint8_t> pixels;
+    };
+
+    SDL_Window* m_window{nullptr};
+    bool m_initialized{false};
+    bool m_imgui_initialized{false};
+    int m_width{0};
+    int m_height{0};
+    std::chrono::steady_clock::time_point m_last_frame{};
+
+    std::unordered_map<uint64_t, TextureData> m_textures;
+    uint64_t m_next_handle_id{1};
+    Stats m_stats;
+};
+
+}  // namespace gwt::gui
@@ -28,8 +28,17 @@
 
 #include <spdlog/spdlog.h>
 
+#include <cstring>
+
 namespace gwt::gui {
 
+namespace {
+
+constexpr size_t kUploadBufferAlignment = 1024 * 1024;     // Grow ring buffers in 1 MiB steps
+constexpr uint64_t kFenceTimeoutNs = 100'000'000;           // Re-check stalled fences every 100 ms
+
+}  // anonymous namespace
+
 // =============================================================================
 // Lifecycle
 // =============================================================================
@@ -94,6 +103,19 @@ bool OpenGLBackend::init(SDL_Window* window) {
     spdlog::info("  Renderer: {}", reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
     spdlog::info("  Version: {}", reinterpret_cast<const char*>(glGetString(GL_VERSION)));
 
+    // Streaming uploads: PBOs and fences are core since GL 3.2 / ES 3.0
+    // (llvmpipe included); persistent mapping additionally needs GL 4.4 or
+    // ARB_buffer_storage, and falls back to per-upload glMapBufferRange.
+#if !defined(IMGUI_IMPL_OPENGL_ES2)
+    m_use_pbo = true;
+#if defined(GL_VERSION_4_4) && !defined(__APPLE__)
+    m_persistent_pbo = (glBufferStorage != nullptr);
+#endif
+#endif
+    spdlog::info("  Uploads: {}", m_persistent_pbo ? "persistent PBO ring"
+                                  : m_use_pbo      ? "PBO ring"
+                                                   : "synchronous");
+
     m_initialized = true;
     clear_error();
     return true;
@@ -102,6 +124,8 @@ bool OpenGLBackend::init(SDL_Window* window) {
 void OpenGLBackend::shutdown() {
     if (!m_initialized) return;
 
+    release_upload_ring();
+
     // Destroy all textures
     for (auto& [id, tex] : m_textures) {
         if (tex.gl_id) {
@@ -241,11 +265,16 @@ OpenGLBackend::create_texture(const TextureDesc& desc, std::span<const uint8_t>
     // Get format
     auto [internal_format, pixel_format] = get_gl_format(desc.format);
 
-    // Upload data (or allocate empty texture)
-    const void* pixel_data = data.empty() ? nullptr : data.data();
+    // Upload data (or allocate empty texture); without mipmaps the data
+    // goes through the upload ring below instead
+    const bool stream_data = m_use_pbo && !data.empty() && !desc.generate_mips;
+    const void* pixel_data = (data.empty() || stream_data) ? nullptr : data.data();
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
     glTexImage2D(GL_TEXTURE_2D, 0, internal_format,
                  desc.width, desc.height, 0,
                  pixel_format, GL_UNSIGNED_BYTE, pixel_data);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    if (pixel_data) note_upload(data.size());
 
     // Generate mipmaps if requested
     if (desc.generate_mips) {
@@ -258,6 +287,10 @@ OpenGLBackend::create_texture(const TextureDesc& desc, std::span<const uint8_t>
     TextureHandle handle{m_next_handle_id++};
     m_textures[handle.id] = TextureData{gl_id, desc};
 
+    if (stream_data) {
+        update_texture_region(handle, TextureRect{0, 0, desc.width, desc.height}, data);
+    }
+
     spdlog::debug("Created texture {} ({}x{}, GL ID: {})",
                   handle.id, desc.width, desc.height, gl_id);
 
@@ -272,14 +305,149 @@ void OpenGLBackend::update_texture(TextureHandle handle, std::span<const uint8_t
         return;
     }
 
+    const auto& desc = it->second.desc;
+    update_texture_region(handle, TextureRect{0, 0, desc.width, desc.height}, data);
+}
+
+void OpenGLBackend::update_texture_region(TextureHandle handle, const TextureRect& rect,
+                                          std::span<const uint8_t> data, size_t stride) {
+    auto it = m_textures.find(handle.id);
+    if (it == m_textures.end()) {
+        spdlog::warn("Attempted to update invalid texture handle: {}", handle.id);
+        return;
+    }
+
     auto& tex = it->second;
+    if (!validate_region(tex.desc, rect, data, stride)) return;
+
     auto [internal_format, pixel_format] = get_gl_format(tex.desc.format);
+    const size_t bpp = bytes_per_pixel(tex.desc.format);
+
+    if (m_use_pbo) {
+        // Copy into the upload ring; the GPU reads it asynchronously
+        TextureUpload upload = map_texture_region(handle, rect);
+        if (upload.valid() && upload.slot != kStagingSlot) {
+            const size_t row_bytes = rect.width * bpp;
+            for (uint32_t row = 0; row < rect.height; ++row) {
+                std::memcpy(upload.data + row * upload.stride, data.data() + row * stride, row_bytes);
+            }
+            commit_texture_region(upload);
+            return;
+        }
+    }
 
     glBindTexture(GL_TEXTURE_2D, tex.gl_id);
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0,
-                    tex.desc.width, tex.desc.height,
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+#if defined(IMGUI_IMPL_OPENGL_ES2)
+    // No GL_UNPACK_ROW_LENGTH on ES2: upload padded sources row by row
+    if (stride == rect.width * bpp) {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x, rect.y, rect.width, rect.height,
+                        pixel_format, GL_UNSIGNED_BYTE, data.data());
+    } else {
+        for (uint32_t row = 0; row < rect.height; ++row) {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x, rect.y + row, rect.width, 1,
+                            pixel_format, GL_UNSIGNED_BYTE, data.data() + row * stride);
+        }
+    }
+#else
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(stride / bpp));
+    glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x, rect.y, rect.width, rect.height,
                     pixel_format, GL_UNSIGNED_BYTE, data.data());
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#endif
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
     glBindTexture(GL_TEXTURE_2D, 0);
+    note_upload(static_cast<uint64_t>(rect.width) * rect.height * bpp);
+}
+
+TextureUpload OpenGLBackend::map_texture_region(TextureHandle handle, const TextureRect& rect) {
+    if (!m_use_pbo) {
+        TextureUpload upload = IRenderBackend::map_texture_region(handle, rect);
+        upload.slot = kStagingSlot;
+        return upload;
+    }
+
+#if !defined(IMGUI_IMPL_OPENGL_ES2)
+    auto it = m_textures.find(handle.id);
+    if (it == m_textures.end() || rect.empty() ||
+        rect.x + rect.width > it->second.desc.width ||
+        rect.y + rect.height > it->second.desc.height) {
+        return TextureUpload{};
+    }
+
+    TextureUpload upload;
+    upload.handle = handle;
+    upload.rect = rect;
+    upload.stride = static_cast<size_t>(rect.width) * bytes_per_pixel(it->second.desc.format);
+    upload.slot = m_upload_next;
+
+    const size_t bytes = upload.stride * rect.height;
+    UploadBuffer& buffer = m_upload_ring[upload.slot];
+    m_upload_next = (m_upload_next + 1) % kUploadRingSize;
+
+    // Normally signalled long ago: the buffer was last used a full ring earlier
+    wait_upload_fence(buffer);
+
+    if (!reserve_upload_buffer(buffer, bytes)) {
+        spdlog::warn("PBO allocation failed, falling back to synchronous uploads");
+        release_upload_ring();
+        m_use_pbo = false;
+        m_persistent_pbo = false;
+        upload = IRenderBackend::map_texture_region(handle, rect);
+        upload.slot = kStagingSlot;
+        return upload;
+    }
+
+    if (buffer.persistent) {
+        upload.data = buffer.persistent;
+    } else {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.gl_id);
+        upload.data = static_cast<uint8_t*>(glMapBufferRange(
+            GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(bytes),
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+    return upload;
+#else
+    return TextureUpload{};
+#endif
+}
+
+void OpenGLBackend::commit_texture_region(const TextureUpload& upload) {
+    if (!upload.valid()) return;
+    if (upload.slot >= kUploadRingSize) {
+        IRenderBackend::commit_texture_region(upload);
+        return;
+    }
+
+#if !defined(IMGUI_IMPL_OPENGL_ES2)
+    UploadBuffer& buffer = m_upload_ring[upload.slot];
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.gl_id);
+    if (!buffer.persistent) {
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+
+    // Texture may have been destroyed while mapped
+    auto it = m_textures.find(upload.handle.id);
+    if (it != m_textures.end()) {
+        auto [internal_format, pixel_format] = get_gl_format(it->second.desc.format);
+        const auto& rect = upload.rect;
+
+        glBindTexture(GL_TEXTURE_2D, it->second.gl_id);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        // Source is offset 0 in the bound unpack buffer
+        glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x, rect.y, rect.width, rect.height,
+                        pixel_format, GL_UNSIGNED_BYTE, nullptr);
+        note_upload(upload.stride * rect.height);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    buffer.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#endif
 }
 
 void OpenGLBackend::destroy_texture(TextureHandle handle) {
@@ -306,6 +474,107 @@ void* OpenGLBackend::get_imgui_texture_id(TextureHandle handle) const {
     return reinterpret_cast<void*>(static_cast<intptr_t>(it->second.gl_id));
 }
 
+const TextureDesc* OpenGLBackend::texture_desc(TextureHandle handle) const {
+    auto it = m_textures.find(handle.id);
+    return it == m_textures.end() ? nullptr : &it->second.desc;
+}
+
+// =============================================================================
+// Upload Ring
+// =============================================================================
+
+bool OpenGLBackend::reserve_upload_buffer(UploadBuffer& buffer, size_t bytes) {
+#if !defined(IMGUI_IMPL_OPENGL_ES2)
+    if (buffer.gl_id && buffer.capacity >= bytes) return true;
+
+    const size_t capacity = (bytes + kUploadBufferAlignment - 1) / kUploadBufferAlignment
+                          * kUploadBufferAlignment;
+
+    // Immutable storage cannot grow: replace the buffer
+    if (buffer.gl_id) {
+        if (buffer.persistent) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.gl_id);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        }
+        glDeleteBuffers(1, &buffer.gl_id);
+        buffer = UploadBuffer{};
+    }
+
+    // Only report errors from this allocation
+    for (int i = 0; i < 8 && glGetError() != GL_NO_ERROR; ++i) {}
+
+    glGenBuffers(1, &buffer.gl_id);
+    if (!buffer.gl_id) return false;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.gl_id);
+
+#if defined(GL_VERSION_4_4) && !defined(__APPLE__)
+    if (m_persistent_pbo) {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(capacity), nullptr, flags);
+        buffer.persistent = static_cast<uint8_t*>(
+            glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(capacity), flags));
+    }
+#endif
+    if (!buffer.persistent) {
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(capacity),
+                     nullptr, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    if (glGetError() != GL_NO_ERROR || (m_persistent_pbo && !buffer.persistent)) {
+        glDeleteBuffers(1, &buffer.gl_id);
+        buffer = UploadBuffer{};
+        return false;
+    }
+
+    buffer.capacity = capacity;
+    spdlog::debug("Upload buffer {} resized to {} KiB", buffer.gl_id, capacity >> 10);
+    return true;
+#else
+    (void)buffer;
+    (void)bytes;
+    return false;
+#endif
+}
+
+void OpenGLBackend::wait_upload_fence(UploadBuffer& buffer) {
+#if !defined(IMGUI_IMPL_OPENGL_ES2)
+    if (!buffer.fence) return;
+
+    auto sync = static_cast<GLsync>(buffer.fence);
+    GLenum status = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceTimeoutNs);
+    while (status == GL_TIMEOUT_EXPIRED) {
+        status = glClientWaitSync(sync, 0, kFenceTimeoutNs);
+    }
+    if (status == GL_WAIT_FAILED) {
+        spdlog::warn("Upload fence wait failed");
+    }
+
+    glDeleteSync(sync);
+    buffer.fence = nullptr;
+#else
+    (void)buffer;
+#endif
+}
+
+void OpenGLBackend::release_upload_ring() {
+#if !defined(IMGUI_IMPL_OPENGL_ES2)
+    for (auto& buffer : m_upload_ring) {
+        wait_upload_fence(buffer);
+        if (buffer.gl_id) {
+            if (buffer.persistent) {
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.gl_id);
+                glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            }
+            glDeleteBuffers(1, &buffer.gl_id);
+        }
+        buffer = UploadBuffer{};
+    }
+    m_upload_next = 0;
+#endif
+}
+
 // =============================================================================
 // Backend Info
 // =============================================================================
@@ -11,6 +11,7 @@
 
 #include <SDL3/SDL.h>
 
+#include <array>
 #include <unordered_map>
 #include <cstdint>
 
@@ -55,9 +56,16 @@ public:
     create_texture(const TextureDesc& desc, std::span<const uint8_t> data = {}) override;
     
     void update_texture(TextureHandle handle, std::span<const uint8_t> data) override;
+    void update_texture_region(TextureHandle handle, const TextureRect& rect,
+                               std::span<const uint8_t> data, size_t stride = 0) override;
     void destroy_texture(TextureHandle handle) override;
+
+    [[nodiscard]] TextureUpload map_texture_region(TextureHandle handle,
+                                                   const TextureRect& rect) override;
+    void commit_texture_region(const TextureUpload& upload) override;
     
     [[nodiscard]] void* get_imgui_texture_id(TextureHandle handle) const override;
+    [[nodiscard]] const TextureDesc* texture_desc(TextureHandle handle) const override;
 
     // ==========================================================================
     // Backend Info
@@ -73,6 +81,23 @@ private:
         TextureDesc desc;
     };
 
+    /**
+     * Pixel unpack buffer of the upload ring
+     *
+     * Uploads rotate through kUploadRingSize buffers; a fence after each
+     * copy lets the buffer be rewritten only once the GPU has read it, so
+     * glTexSubImage2D returns immediately instead of copying client memory.
+     */
+    struct UploadBuffer {
+        uint32_t gl_id{0};
+        size_t capacity{0};
+        uint8_t* persistent{nullptr};   // Persistent mapping (GL 4.4 / ARB_buffer_storage)
+        void* fence{nullptr};           // GLsync of the last copy out of this buffer
+    };
+
+    static constexpr uint32_t kUploadRingSize = 4;
+    static constexpr uint32_t kStagingSlot = ~0u;  // Upload mapped by the base class
+
     SDL_Window* m_window{nullptr};
     SDL_GLContext m_gl_context{nullptr};
     
@@ -83,8 +108,18 @@ private:
     int m_window_height{0};
     bool m_initialized{false};
 
+    std::array<UploadBuffer, kUploadRingSize> m_upload_ring;
+    uint32_t m_upload_next{0};
+    bool m_use_pbo{false};              // Pixel buffer objects available (not ES2)
+    bool m_persistent_pbo{false};       // Buffers stay mapped between uploads
+
     // Helper to convert TextureFormat to OpenGL format
     static std::pair<uint32_t, uint32_t> get_gl_format(TextureFormat format);
+
+    // Upload ring helpers
+    bool reserve_upload_buffer(UploadBuffer& buffer, size_t bytes);
+    static void wait_upload_fence(UploadBuffer& buffer);
+    void release_upload_ring();
 };
 
 }  // namespace gwt::gui
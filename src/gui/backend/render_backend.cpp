@@ -7,6 +7,7 @@
 
 #include "gui/backend/render_backend.hpp"
 #include "gui/backend/opengl_backend.hpp"
+#include "gui/backend/null_backend.hpp"
 
 #if defined(_WIN32)
 #include "gui/backend/d3d11_backend.hpp"
@@ -20,6 +21,52 @@
 
 namespace gwt::gui {
 
+bool IRenderBackend::validate_region(const TextureDesc& desc, const TextureRect& rect,
+                                     std::span<const uint8_t> data, size_t& stride) {
+    if (rect.empty()) return false;
+
+    if (rect.x + rect.width > desc.width || rect.y + rect.height > desc.height) {
+        spdlog::warn("Texture region {}x{}+{}+{} outside {}x{} texture",
+                     rect.width, rect.height, rect.x, rect.y, desc.width, desc.height);
+        return false;
+    }
+
+    const size_t bpp = bytes_per_pixel(desc.format);
+    const size_t row_bytes = static_cast<size_t>(rect.width) * bpp;
+    if (stride == 0) stride = row_bytes;
+
+    if (stride < row_bytes || stride % bpp != 0 ||
+        data.size() < stride * (rect.height - 1) + row_bytes) {
+        spdlog::warn("Texture region data too small or misaligned (stride {}, {} bytes)",
+                     stride, data.size());
+        return false;
+    }
+    return true;
+}
+
+TextureUpload IRenderBackend::map_texture_region(TextureHandle handle, const TextureRect& rect) {
+    const TextureDesc* desc = texture_desc(handle);
+    if (!desc || rect.empty() ||
+        rect.x + rect.width > desc->width || rect.y + rect.height > desc->height) {
+        return TextureUpload{};
+    }
+
+    TextureUpload upload;
+    upload.handle = handle;
+    upload.rect = rect;
+    upload.stride = static_cast<size_t>(rect.width) * bytes_per_pixel(desc->format);
+    m_upload_staging.resize(upload.stride * rect.height);
+    upload.data = m_upload_staging.data();
+    return upload;
+}
+
+void IRenderBackend::commit_texture_region(const TextureUpload& upload) {
+    if (!upload.valid()) return;
+    update_texture_region(upload.handle, upload.rect,
+                          std::span<const uint8_t>(upload.data, upload.stride * upload.rect.height),
+                          upload.stride);
+}
+
 std::unique_ptr<IRenderBackend> create_backend(BackendType type) {
     // Auto mode: try backends in order of preference (platform-specific)
     if (type == BackendType::Auto) {
@@ -62,6 +109,10 @@ std::unique_ptr<IRenderBackend> create_backend(BackendType type) {
             return std::make_unique<VulkanBackend>();
 #endif
 
+        case BackendType::Null:
+            spdlog::info("Creating Null backend");
+            return std::make_unique<NullBackend>();
+
         default:
             spdlog::error("Unknown backend type requested");
             return nullptr;
@@ -86,6 +137,10 @@ bool is_backend_available(BackendType type) noexcept {
             return VulkanBackend::is_available();
 #endif
 
+        case BackendType::Null:
+            // Needs neither a window nor a GPU
+            return true;
+
         case BackendType::Auto:
             // Auto is always "available" (will fall back)
             return true;
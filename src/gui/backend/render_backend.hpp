@@ -5,7 +5,8 @@
  * @license MIT
  *
  * @details
- * Defines the interface for render backends (OpenGL, D3D11, Vulkan).
+ * Defines the interface for render backends (OpenGL, D3D11, Vulkan, and
+ * a headless Null backend).
  * Allows GUI to be decoupled from specific graphics API.
  */
 
@@ -16,6 +17,7 @@
 #include <optional>
 #include <span>
 #include <string_view>
+#include <vector>
 
 // Forward declarations
 struct SDL_Window;
@@ -83,6 +85,41 @@ struct TextureDesc {
     bool generate_mips{false};
 };
 
+/**
+ * Sub-rectangle of a texture, in texels
+ */
+struct TextureRect {
+    uint32_t x{0};
+    uint32_t y{0};
+    uint32_t width{0};
+    uint32_t height{0};
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return width == 0 || height == 0; }
+};
+
+/**
+ * Mapped staging memory for one region update (see map_texture_region)
+ */
+struct TextureUpload {
+    TextureHandle handle;
+    TextureRect rect;
+    uint8_t* data{nullptr};     // First row of the region (write-only)
+    size_t stride{0};           // Bytes between rows
+    uint32_t slot{0};           // Backend staging slot
+
+    [[nodiscard]] constexpr bool valid() const noexcept { return data != nullptr; }
+};
+
+[[nodiscard]] constexpr uint32_t bytes_per_pixel(TextureFormat format) noexcept {
+    switch (format) {
+        case TextureFormat::RGB8:
+        case TextureFormat::BGR8:  return 3;
+        case TextureFormat::RGBA8:
+        case TextureFormat::BGRA8: return 4;
+        default:                   return 4;
+    }
+}
+
 // =============================================================================
 // Backend Type
 // =============================================================================
@@ -95,7 +132,8 @@ enum class BackendType {
 #if defined(GWT_HAS_VULKAN)
     Vulkan,
 #endif
-    Auto  // Auto-select best available
+    Null,  // Headless: textures in system memory, nothing rendered
+    Auto   // Auto-select best available
 };
 
 [[nodiscard]] constexpr std::string_view to_string(BackendType type) noexcept {
@@ -107,6 +145,7 @@ enum class BackendType {
 #if defined(GWT_HAS_VULKAN)
         case BackendType::Vulkan: return "Vulkan";
 #endif
+        case BackendType::Null:   return "Null";
         case BackendType::Auto:   return "Auto";
         default:                  return "Unknown";
     }
@@ -208,6 +247,40 @@ public:
      */
     virtual void update_texture(TextureHandle handle, std::span<const uint8_t> data) = 0;
 
+    /**
+     * Update a sub-rectangle of a texture
+     * @param handle  Texture handle
+     * @param rect    Destination rectangle (must lie within the texture)
+     * @param data    Pixel data of the rectangle, top row first
+     * @param stride  Bytes between source rows (0 = rect.width * bytes per pixel)
+     */
+    virtual void update_texture_region(TextureHandle handle, const TextureRect& rect,
+                                       std::span<const uint8_t> data, size_t stride = 0) = 0;
+
+    /**
+     * Map staging memory for a region update, so pixels can be converted
+     * straight into upload memory instead of an intermediate buffer.
+     * Every map must be followed by commit_texture_region() before the
+     * next map. The default stages in system memory and commits through
+     * update_texture_region().
+     * @return Invalid upload if handle or rect is invalid
+     */
+    [[nodiscard]] virtual TextureUpload map_texture_region(TextureHandle handle,
+                                                           const TextureRect& rect);
+
+    /**
+     * Upload a region written through map_texture_region()
+     */
+    virtual void commit_texture_region(const TextureUpload& upload);
+
+    /**
+     * Get the description of a texture (nullptr if handle is invalid)
+     */
+    [[nodiscard]] virtual const TextureDesc* texture_desc(TextureHandle handle) const {
+        (void)handle;
+        return nullptr;
+    }
+
     /**
      * Destroy a texture
      * @param handle  Texture handle
@@ -245,6 +318,12 @@ public:
      */
     [[nodiscard]] BackendError last_error() const noexcept { return m_last_error; }
 
+    /**
+     * Texel bytes handed to the GPU since creation (texture creation with
+     * data, region updates and commits), for diagnostics
+     */
+    [[nodiscard]] uint64_t bytes_uploaded() const noexcept { return m_bytes_uploaded; }
+
 protected:
     IRenderBackend() = default;
     IRenderBackend(IRenderBackend&&) = default;
@@ -252,8 +331,21 @@ protected:
 
     void set_error(BackendError error) noexcept { m_last_error = error; }
     void clear_error() noexcept { m_last_error = BackendError::None; }
+    void note_upload(uint64_t bytes) noexcept { m_bytes_uploaded += bytes; }
+
+    /**
+     * Check a region update against the texture; resolves stride 0 to the
+     * packed row size
+     * @return false (with a warning logged) if the update must be ignored
+     */
+    [[nodiscard]] static bool validate_region(const TextureDesc& desc, const TextureRect& rect,
+                                              std::span<const uint8_t> data, size_t& stride);
 
     BackendError m_last_error{BackendError::None};
+
+private:
+    std::vector<uint8_t> m_upload_staging;  // Default map_texture_region() memory
+    uint64_t m_bytes_uploaded{0};
 };
 
 // =============================================================================
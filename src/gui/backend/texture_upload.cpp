@@ -0,0 +1,51 @@
+/**
+ * @file    texture_upload.cpp
+ * @brief   Image upload helpers implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#include "gui/backend/texture_upload.hpp"
+
+#include <opencv2/imgproc.hpp>
+
+namespace gwt::gui {
+
+bool upload_image(IRenderBackend& backend, TextureHandle handle, const cv::Mat& image,
+                  uint32_t x, uint32_t y) {
+    if (image.empty() || image.depth() != CV_8U) return false;
+
+    const TextureRect rect{x, y, static_cast<uint32_t>(image.cols), static_cast<uint32_t>(image.rows)};
+    TextureUpload upload = backend.map_texture_region(handle, rect);
+    if (!upload.valid()) return false;
+
+    // Same size and type: cvtColor/copyTo write in place instead of reallocating
+    cv::Mat target(image.rows, image.cols, CV_8UC4, upload.data, upload.stride);
+    switch (image.channels()) {
+        case 1:  cv::cvtColor(image, target, cv::COLOR_GRAY2RGBA); break;
+        case 3:  cv::cvtColor(image, target, cv::COLOR_BGR2RGBA); break;
+        case 4:  cv::cvtColor(image, target, cv::COLOR_BGRA2RGBA); break;
+        default: target.setTo(cv::Scalar::all(0)); break;
+    }
+
+    backend.commit_texture_region(upload);
+    return true;
+}
+
+TextureHandle create_image_texture(IRenderBackend& backend, const cv::Mat& image) {
+    if (image.empty()) return TextureHandle{};
+
+    TextureDesc desc;
+    desc.width = static_cast<uint32_t>(image.cols);
+    desc.height = static_cast<uint32_t>(image.rows);
+    desc.format = TextureFormat::RGBA8;
+
+    TextureHandle handle = backend.create_texture(desc);
+    if (handle.valid() && !upload_image(backend, handle, image)) {
+        backend.destroy_texture(handle);
+        return TextureHandle{};
+    }
+    return handle;
+}
+
+}  // namespace gwt::gui
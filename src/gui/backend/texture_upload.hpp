@@ -0,0 +1,38 @@
+/**
+ * @file    texture_upload.hpp
+ * @brief   Convert OpenCV images straight into texture upload memory
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#pragma once
+
+#include "gui/backend/render_backend.hpp"
+
+#include <opencv2/core.hpp>
+
+namespace gwt::gui {
+
+/**
+ * Upload a BGR, BGRA or grayscale image into an RGBA8 texture region
+ *
+ * The color conversion writes directly into the memory returned by
+ * IRenderBackend::map_texture_region() (a mapped PBO on OpenGL), so no
+ * intermediate RGBA copy is made.
+ *
+ * @param backend  Render backend owning the texture
+ * @param handle   RGBA8 texture
+ * @param image    Source pixels (8-bit, 1/3/4 channels)
+ * @param x, y     Destination offset within the texture
+ * @return         false if the region could not be mapped
+ */
+bool upload_image(IRenderBackend& backend, TextureHandle handle, const cv::Mat& image,
+                  uint32_t x = 0, uint32_t y = 0);
+
+/**
+ * Create an RGBA8 texture from a BGR, BGRA or grayscale image
+ * @return Invalid handle on failure (check backend.last_error())
+ */
+[[nodiscard]] TextureHandle create_image_texture(IRenderBackend& backend, const cv::Mat& image);
+
+}  // namespace gwt::gui
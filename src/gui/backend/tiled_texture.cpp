@@ -0,0 +1,193 @@
+/**
+ * @file    tiled_texture.cpp
+ * @brief   Tiled, mipmapped texture implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#include "gui/backend/tiled_texture.hpp"
+#include "gui/backend/texture_upload.hpp"
+
+#include <opencv2/imgproc.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace gwt::gui {
+
+TiledTexture::TiledTexture(IRenderBackend& backend, size_t budget_bytes)
+    : m_backend(backend)
+    , m_budget_bytes(budget_bytes)
+{
+}
+
+TiledTexture::~TiledTexture() {
+    clear();
+}
+
+// =============================================================================
+// Image
+// =============================================================================
+
+std::vector<cv::Mat> TiledTexture::build_pyramid(const cv::Mat& image) {
+    std::vector<cv::Mat> levels;
+    if (image.empty()) return levels;
+
+    levels.push_back(image);
+    while (levels.back().cols > kTileSize || levels.back().rows > kTileSize) {
+        const cv::Mat& prev = levels.back();
+        cv::Mat next;
+        cv::resize(prev, next,
+                   cv::Size(std::max(1, (prev.cols + 1) / 2), std::max(1, (prev.rows + 1) / 2)),
+                   0, 0, cv::INTER_AREA);
+        levels.push_back(std::move(next));
+    }
+    return levels;
+}
+
+void TiledTexture::set_pyramid(std::vector<cv::Mat> levels) {
+    clear();
+    m_levels = std::move(levels);
+
+    if (!m_levels.empty()) {
+        spdlog::debug("TiledTexture: {}x{}, {} levels",
+                      m_levels[0].cols, m_levels[0].rows, m_levels.size());
+    }
+}
+
+void TiledTexture::clear() {
+    m_pending_uploads = false;
+    for (auto& [key, tile] : m_tiles) {
+        m_backend.destroy_texture(tile.texture);
+    }
+    m_tiles.clear();
+    m_levels.clear();
+    m_resident_bytes = 0;
+}
+
+// =============================================================================
+// Drawing
+// =============================================================================
+
+int TiledTexture::choose_level(float scale) const noexcept {
+    // Finest level whose resolution is still at least the screen's
+    if (scale >= 1.0f || m_levels.empty()) return 0;
+    const int level = static_cast<int>(std::floor(std::log2(1.0f / scale)));
+    return std::clamp(level, 0, static_cast<int>(m_levels.size()) - 1);
+}
+
+void TiledTexture::draw(ImDrawList* draw_list, ImVec2 pos, float scale,
+                        ImVec2 clip_min, ImVec2 clip_max) {
+    if (m_levels.empty() || scale <= 0.0f) return;
+
+    ++m_frame;
+    m_uploads_this_frame = 0;
+    m_pending_uploads = false;
+
+    // Coarsest level first: always resident, fills in while finer tiles load
+    const int top = static_cast<int>(m_levels.size()) - 1;
+    draw_level(draw_list, top, pos, scale, clip_min, clip_max, true);
+
+    const int level = choose_level(scale);
+    if (level < top) {
+        draw_level(draw_list, level, pos, scale, clip_min, clip_max, false);
+    }
+
+    evict_to_budget();
+}
+
+void TiledTexture::draw_level(ImDrawList* draw_list, int level, ImVec2 pos, float scale,
+                              ImVec2 clip_min, ImVec2 clip_max, bool required) {
+    const cv::Mat& base = m_levels[0];
+    const cv::Mat& image = m_levels[static_cast<size_t>(level)];
+
+    // Screen pixels per level pixel (levels may round up odd sizes)
+    const float sx = scale * static_cast<float>(base.cols) / static_cast<float>(image.cols);
+    const float sy = scale * static_cast<float>(base.rows) / static_cast<float>(image.rows);
+
+    // Visible range in level pixels
+    const int x0 = std::max(0, static_cast<int>(std::floor((clip_min.x - pos.x) / sx)));
+    const int y0 = std::max(0, static_cast<int>(std::floor((clip_min.y - pos.y) / sy)));
+    const int x1 = std::min(image.cols, static_cast<int>(std::ceil((clip_max.x - pos.x) / sx)));
+    const int y1 = std::min(image.rows, static_cast<int>(std::ceil((clip_max.y - pos.y) / sy)));
+    if (x0 >= x1 || y0 >= y1) return;
+
+    for (int ty = y0 / kTileSize; ty <= (y1 - 1) / kTileSize; ++ty) {
+        for (int tx = x0 / kTileSize; tx <= (x1 - 1) / kTileSize; ++tx) {
+            Tile* tile = acquire(level, tx, ty, required);
+            if (!tile) continue;
+
+            const int px0 = tx * kTileSize;
+            const int py0 = ty * kTileSize;
+            const int px1 = std::min(px0 + kTileSize, image.cols);
+            const int py1 = std::min(py0 + kTileSize, image.rows);
+
+            draw_list->AddImage(
+                reinterpret_cast<ImTextureID>(m_backend.get_imgui_texture_id(tile->texture)),
+                ImVec2(pos.x + px0 * sx, pos.y + py0 * sy),
+                ImVec2(pos.x + px1 * sx, pos.y + py1 * sy),
+                ImVec2(0, 0), ImVec2(1, 1), IM_COL32_WHITE
+            );
+        }
+    }
+}
+
+TiledTexture::Tile* TiledTexture::acquire(int level, int tx, int ty, bool required) {
+    const uint64_t key = tile_key(level, tx, ty);
+    if (auto it = m_tiles.find(key); it != m_tiles.end()) {
+        it->second.last_used = m_frame;
+        return &it->second;
+    }
+
+    if (!required && m_uploads_this_frame >= kMaxUploadsPerFrame) {
+        m_pending_uploads = true;
+        return nullptr;  // Try again next frame; coarser level shows meanwhile
+    }
+
+    const cv::Mat& image = m_levels[static_cast<size_t>(level)];
+    const cv::Rect roi = cv::Rect(tx * kTileSize, ty * kTileSize, kTileSize, kTileSize)
+                       & cv::Rect(0, 0, image.cols, image.rows);
+    if (roi.empty()) return nullptr;
+
+    // Converted straight into upload memory
+    TextureHandle texture = create_image_texture(m_backend, image(roi));
+    ++m_uploads_this_frame;
+
+    if (!texture.valid()) {
+        spdlog::error("TiledTexture: failed to create tile L{} ({}, {}): {}",
+                      level, tx, ty, to_string(m_backend.last_error()));
+        return nullptr;
+    }
+
+    Tile tile;
+    tile.texture = texture;
+    tile.bytes = static_cast<size_t>(roi.area()) * 4;
+    tile.last_used = m_frame;
+    m_resident_bytes += tile.bytes;
+
+    return &m_tiles.emplace(key, tile).first->second;
+}
+
+void TiledTexture::evict_to_budget() {
+    const int top = static_cast<int>(m_levels.size()) - 1;
+
+    while (m_resident_bytes > m_budget_bytes) {
+        // Least recently used tile that is neither on screen nor in the top level
+        auto victim = m_tiles.end();
+        for (auto it = m_tiles.begin(); it != m_tiles.end(); ++it) {
+            const int level = static_cast<int>(it->first >> 48);
+            if (it->second.last_used == m_frame || level == top) continue;
+            if (victim == m_tiles.end() || it->second.last_used < victim->second.last_used) {
+                victim = it;
+            }
+        }
+        if (victim == m_tiles.end()) break;
+
+        m_backend.destroy_texture(victim->second.texture);
+        m_resident_bytes -= victim->second.bytes;
+        m_tiles.erase(victim);
+    }
+}
+
+}  // namespace gwt::gui
@@ -0,0 +1,122 @@
+/**
+ * @file    tiled_texture.hpp
+ * @brief   Tiled, mipmapped texture for very large preview images
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * A single RGBA8 texture fails beyond the driver's max texture size and
+ * costs 4 bytes per pixel of VRAM whether or not it is on screen (400 MB
+ * for a 100 MP image). Instead, the image is kept on the CPU as a mip
+ * pyramid (level 0 shares the original Mat; each level halves the size
+ * until it fits in one tile), and split into kTileSize^2 tiles that are
+ * converted and uploaded only when visible at the level matching the
+ * current zoom.
+ *
+ * The coarsest level always stays resident and is drawn first, so areas
+ * whose fine tiles are not uploaded yet show a blurry placeholder rather
+ * than nothing. Uploads are capped per frame; tiles not drawn in the
+ * current frame are evicted least-recently-used once the VRAM budget is
+ * exceeded.
+ */
+
+#pragma once
+
+#include "gui/backend/render_backend.hpp"
+
+#include <opencv2/core.hpp>
+#include <imgui.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace gwt::gui {
+
+class TiledTexture {
+public:
+    static constexpr int kTileSize = 2048;
+    static constexpr size_t kDefaultBudgetBytes = 512ull * 1024 * 1024;
+    static constexpr int kMaxUploadsPerFrame = 4;
+
+    /**
+     * @param backend       Render backend (must outlive this object)
+     * @param budget_bytes  VRAM budget for tiles (the coarsest level is exempt)
+     */
+    explicit TiledTexture(IRenderBackend& backend, size_t budget_bytes = kDefaultBudgetBytes);
+    ~TiledTexture();
+
+    TiledTexture(const TiledTexture&) = delete;
+    TiledTexture& operator=(const TiledTexture&) = delete;
+
+    /**
+     * Build a mip pyramid (CPU only, safe on worker threads)
+     * Level 0 shares image's data; each further level is half the size
+     * (INTER_AREA) until the level fits in a single tile.
+     */
+    [[nodiscard]] static std::vector<cv::Mat> build_pyramid(const cv::Mat& image);
+
+    /**
+     * Replace the image (drops all resident tiles)
+     * @param levels  Pyramid from build_pyramid()
+     */
+    void set_pyramid(std::vector<cv::Mat> levels);
+
+    /**
+     * Drop the image and destroy all tiles
+     */
+    void clear();
+
+    [[nodiscard]] bool empty() const noexcept { return m_levels.empty(); }
+    [[nodiscard]] int level_count() const noexcept { return static_cast<int>(m_levels.size()); }
+    [[nodiscard]] size_t resident_bytes() const noexcept { return m_resident_bytes; }
+    [[nodiscard]] size_t resident_tiles() const noexcept { return m_tiles.size(); }
+
+    /**
+     * True if the last draw() skipped visible tiles because of the
+     * per-frame upload cap (another frame is needed to complete them)
+     */
+    [[nodiscard]] bool has_pending_uploads() const noexcept { return m_pending_uploads; }
+
+    /**
+     * Draw the visible part of the image, uploading tiles as needed
+     *
+     * @param draw_list  Target draw list
+     * @param pos        Screen position of image pixel (0, 0)
+     * @param scale      Screen pixels per image pixel
+     * @param clip_min   Top-left of the visible screen area
+     * @param clip_max   Bottom-right of the visible screen area
+     */
+    void draw(ImDrawList* draw_list, ImVec2 pos, float scale, ImVec2 clip_min, ImVec2 clip_max);
+
+private:
+    struct Tile {
+        TextureHandle texture;
+        size_t bytes{0};
+        uint64_t last_used{0};
+    };
+
+    [[nodiscard]] static uint64_t tile_key(int level, int tx, int ty) noexcept {
+        return (static_cast<uint64_t>(level) << 48) |
+               (static_cast<uint64_t>(ty) << 24) |
+               static_cast<uint64_t>(tx);
+    }
+
+    [[nodiscard]] int choose_level(float scale) const noexcept;
+    void draw_level(ImDrawList* draw_list, int level, ImVec2 pos, float scale,
+                    ImVec2 clip_min, ImVec2 clip_max, bool required);
+    Tile* acquire(int level, int tx, int ty, bool required);
+    void evict_to_budget();
+
+    IRenderBackend& m_backend;
+    size_t m_budget_bytes;
+
+    std::vector<cv::Mat> m_levels;
+    std::unordered_map<uint64_t, Tile> m_tiles;
+    size_t m_resident_bytes{0};
+    uint64_t m_frame{0};
+    int m_uploads_this_frame{0};
+    bool m_pending_uploads{false};
+};
+
+}  // namespace gwt::gui
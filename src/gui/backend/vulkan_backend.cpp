@@ -1,26 +1,69 @@
 /**
  * @file    vulkan_backend.cpp
- * @brief   Vulkan Render Backend Implementation (Stub)
+ * @brief   Vulkan Render Backend Implementation
  * @author  AllenK (Kwyshell)
  * @license MIT
- *
- * @details
- * This is a stub implementation for Vulkan backend.
- * Full implementation will be added in a future phase.
  */
 
 #if defined(GWT_HAS_VULKAN)
 
+#define VMA_IMPLEMENTATION
 #include "gui/backend/vulkan_backend.hpp"
 
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_vulkan.h>
-#include <vulkan/vulkan.h>
+#include <imgui.h>
+#include <imgui_impl_sdl3.h>
+#include <imgui_impl_vulkan.h>
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
 namespace gwt::gui {
 
+namespace {
+
+constexpr uint32_t kApiVersion = VK_API_VERSION_1_2;
+constexpr VkClearColorValue kClearColor{{0.1f, 0.1f, 0.1f, 1.0f}};
+
+void check_vk_result(VkResult result) {
+    if (result != VK_SUCCESS) {
+        spdlog::error("Vulkan error: {}", static_cast<int>(result));
+    }
+}
+
+bool has_extension(const std::vector<VkExtensionProperties>& extensions, const char* name) {
+    return std::any_of(extensions.begin(), extensions.end(), [name](const auto& e) {
+        return std::strcmp(e.extensionName, name) == 0;
+    });
+}
+
+VkFormat to_vk_format(TextureFormat format) {
+    // 3-channel formats are expanded on upload (RGB8 is rarely sampleable)
+    switch (format) {
+        case TextureFormat::BGR8:
+        case TextureFormat::BGRA8: return VK_FORMAT_B8G8R8A8_UNORM;
+        case TextureFormat::RGB8:
+        case TextureFormat::RGBA8:
+        default:                   return VK_FORMAT_R8G8B8A8_UNORM;
+    }
+}
+
+int device_score(VkPhysicalDeviceType type) {
+    switch (type) {
+        case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU:   return 4;
+        case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU: return 3;
+        case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU:    return 2;
+        case VK_PHYSICAL_DEVICE_TYPE_CPU:            return 1;  // lavapipe, SwiftShader
+        default:                                     return 0;
+    }
+}
+
+}  // anonymous namespace
+
 // =============================================================================
 // Static Methods
 // =============================================================================
@@ -31,7 +74,7 @@ bool VulkanBackend::is_available() noexcept {
         spdlog::debug("Vulkan library not available: {}", SDL_GetError());
         return false;
     }
-    
+
     // Check if we can create an instance
     VkApplicationInfo app_info{};
     app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
@@ -39,7 +82,7 @@ bool VulkanBackend::is_available() noexcept {
     app_info.applicationVersion = VK_MAKE_VERSION(0, 2, 0);
     app_info.pEngineName = "No Engine";
     app_info.engineVersion = VK_MAKE_VERSION(1, 0, 0);
-    app_info.apiVersion = VK_API_VERSION_1_2;
+    app_info.apiVersion = kApiVersion;
 
     VkInstanceCreateInfo create_info{};
     create_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
@@ -47,13 +90,13 @@ bool VulkanBackend::is_available() noexcept {
 
     VkInstance test_instance{VK_NULL_HANDLE};
     VkResult result = vkCreateInstance(&create_info, nullptr, &test_instance);
-    
+
     if (result == VK_SUCCESS && test_instance) {
         vkDestroyInstance(test_instance, nullptr);
         SDL_Vulkan_UnloadLibrary();
         return true;
     }
-    
+
     SDL_Vulkan_UnloadLibrary();
     spdlog::debug("Vulkan instance creation failed: {}", static_cast<int>(result));
     return false;
@@ -83,51 +126,585 @@ bool VulkanBackend::init(SDL_Window* window) {
 
     m_window = window;
 
-    // TODO: Full Vulkan initialization
-    // - Create VkInstance
-    // - Select physical device
-    // - Create logical device
-    // - Create swap chain
-    // - Create render pass
-    // - Create command pool/buffers
-    // - etc.
-
-    spdlog::warn("Vulkan backend is not fully implemented yet");
-    set_error(BackendError::InitFailed);
-    return false;
+    // Release whatever was created before a failure
+    auto fail = [this](BackendError error) {
+        m_initialized = true;
+        shutdown();
+        set_error(error);
+        return false;
+    };
+
+    if (!create_instance()) {
+        return fail(BackendError::InitFailed);
+    }
+
+    if (!SDL_Vulkan_CreateSurface(window, m_instance, nullptr, &m_surface)) {
+        spdlog::error("Failed to create Vulkan surface: {}", SDL_GetError());
+        return fail(BackendError::ContextCreationFailed);
+    }
+
+    if (!select_physical_device() || !create_device()) {
+        return fail(BackendError::ContextCreationFailed);
+    }
+
+    if (!create_render_pass() || !create_frames() || !create_staging_ring() ||
+        !create_swapchain()) {
+        return fail(BackendError::InitFailed);
+    }
+
+    m_initialized = true;
+    clear_error();
+    return true;
 }
 
 void VulkanBackend::shutdown() {
     if (!m_initialized) return;
 
-    // TODO: Cleanup Vulkan resources
+    if (m_device) {
+        vkDeviceWaitIdle(m_device);
+
+        for (auto& frame : m_frames) {
+            release_frame(frame);
+            if (frame.fence) vkDestroyFence(m_device, frame.fence, nullptr);
+            if (frame.image_acquired) vkDestroySemaphore(m_device, frame.image_acquired, nullptr);
+            if (frame.command_pool) vkDestroyCommandPool(m_device, frame.command_pool, nullptr);
+            frame = FrameData{};
+        }
+
+        // Descriptor sets go away with the pool
+        for (auto& garbage : m_pending_garbage) {
+            garbage.descriptor = VK_NULL_HANDLE;
+            destroy_garbage(garbage);
+        }
+        m_pending_garbage.clear();
+        for (auto& [id, tex] : m_textures) {
+            destroy_garbage(Garbage{tex.image, tex.allocation, tex.view});
+        }
+        m_textures.clear();
+        m_pending_copies.clear();
+        m_pending_init.clear();
+
+        destroy_swapchain_resources();
+        if (m_swapchain) vkDestroySwapchainKHR(m_device, m_swapchain, nullptr);
+        m_swapchain = VK_NULL_HANDLE;
+
+        if (m_ring_buffer) vmaDestroyBuffer(m_allocator, m_ring_buffer, m_ring_allocation);
+        m_ring_buffer = VK_NULL_HANDLE;
+        m_ring_mapped = nullptr;
 
-    m_textures.clear();
+        if (m_sampler) vkDestroySampler(m_device, m_sampler, nullptr);
+        if (m_render_pass) vkDestroyRenderPass(m_device, m_render_pass, nullptr);
+        if (m_descriptor_pool) vkDestroyDescriptorPool(m_device, m_descriptor_pool, nullptr);
+        if (m_allocator) vmaDestroyAllocator(m_allocator);
+        vkDestroyDevice(m_device, nullptr);
+    }
+
+    if (m_surface) vkDestroySurfaceKHR(m_instance, m_surface, nullptr);
+    if (m_instance) vkDestroyInstance(m_instance, nullptr);
+
+    m_sampler = VK_NULL_HANDLE;
+    m_render_pass = VK_NULL_HANDLE;
+    m_descriptor_pool = VK_NULL_HANDLE;
+    m_allocator = VK_NULL_HANDLE;
+    m_device = VK_NULL_HANDLE;
+    m_surface = VK_NULL_HANDLE;
+    m_instance = VK_NULL_HANDLE;
     m_window = nullptr;
     m_initialized = false;
 
     spdlog::debug("Vulkan backend shutdown complete");
 }
 
+// =============================================================================
+// Setup
+// =============================================================================
+
+bool VulkanBackend::create_instance() {
+    Uint32 sdl_count = 0;
+    const char* const* sdl_extensions = SDL_Vulkan_GetInstanceExtensions(&sdl_count);
+    if (!sdl_extensions) {
+        spdlog::error("SDL_Vulkan_GetInstanceExtensions failed: {}", SDL_GetError());
+        return false;
+    }
+    std::vector<const char*> extensions(sdl_extensions, sdl_extensions + sdl_count);
+
+    uint32_t available_count = 0;
+    vkEnumerateInstanceExtensionProperties(nullptr, &available_count, nullptr);
+    std::vector<VkExtensionProperties> available(available_count);
+    vkEnumerateInstanceExtensionProperties(nullptr, &available_count, available.data());
+
+    VkInstanceCreateInfo create_info{};
+    create_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+
+    // MoltenVK only enumerates with portability enumeration enabled
+#if defined(VK_KHR_portability_enumeration)
+    if (has_extension(available, VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME)) {
+        extensions.push_back(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME);
+        create_info.flags |= VK_INSTANCE_CREATE_ENUMERATE_PORTABILITY_BIT_KHR;
+    }
+#endif
+
+    VkApplicationInfo app_info{};
+    app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    app_info.pApplicationName = "GeminiWatermarkTool";
+    app_info.applicationVersion = VK_MAKE_VERSION(0, 2, 0);
+    app_info.pEngineName = "No Engine";
+    app_info.engineVersion = VK_MAKE_VERSION(1, 0, 0);
+    app_info.apiVersion = kApiVersion;
+
+    create_info.pApplicationInfo = &app_info;
+    create_info.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+    create_info.ppEnabledExtensionNames = extensions.data();
+
+#if defined(DEBUG) || defined(_DEBUG)
+    // Validation layer in debug builds, when installed
+    const char* validation_layer = "VK_LAYER_KHRONOS_validation";
+    uint32_t layer_count = 0;
+    vkEnumerateInstanceLayerProperties(&layer_count, nullptr);
+    std::vector<VkLayerProperties> layers(layer_count);
+    vkEnumerateInstanceLayerProperties(&layer_count, layers.data());
+    if (std::any_of(layers.begin(), layers.end(), [&](const auto& l) {
+            return std::strcmp(l.layerName, validation_layer) == 0; })) {
+        create_info.enabledLayerCount = 1;
+        create_info.ppEnabledLayerNames = &validation_layer;
+        spdlog::debug("Vulkan validation layer enabled");
+    }
+#endif
+
+    VkResult result = vkCreateInstance(&create_info, nullptr, &m_instance);
+    if (result != VK_SUCCESS) {
+        spdlog::error("vkCreateInstance failed: {}", static_cast<int>(result));
+        return false;
+    }
+    return true;
+}
+
+bool VulkanBackend::select_physical_device() {
+    uint32_t count = 0;
+    vkEnumeratePhysicalDevices(m_instance, &count, nullptr);
+    std::vector<VkPhysicalDevice> devices(count);
+    vkEnumeratePhysicalDevices(m_instance, &count, devices.data());
+
+    int best_score = -1;
+    for (VkPhysicalDevice device : devices) {
+        VkPhysicalDeviceProperties props;
+        vkGetPhysicalDeviceProperties(device, &props);
+
+        // Needs a queue that can both draw and present to our surface
+        uint32_t family_count = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(device, &family_count, nullptr);
+        std::vector<VkQueueFamilyProperties> families(family_count);
+        vkGetPhysicalDeviceQueueFamilyProperties(device, &family_count, families.data());
+
+        for (uint32_t i = 0; i < family_count; ++i) {
+            VkBool32 present = VK_FALSE;
+            vkGetPhysicalDeviceSurfaceSupportKHR(device, i, m_surface, &present);
+            if (!(families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) || !present) continue;
+
+            const int score = device_score(props.deviceType);
+            if (score > best_score) {
+                best_score = score;
+                m_physical_device = device;
+                m_queue_family = i;
+            }
+            break;
+        }
+    }
+
+    if (!m_physical_device) {
+        spdlog::error("No Vulkan device can present to this window");
+        return false;
+    }
+
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(m_physical_device, &props);
+    m_ring_alignment = std::max<VkDeviceSize>(4, props.limits.optimalBufferCopyOffsetAlignment);
+
+    spdlog::info("Vulkan initialized:");
+    spdlog::info("  Device: {}", props.deviceName);
+    spdlog::info("  API: {}.{}.{}", VK_API_VERSION_MAJOR(props.apiVersion),
+                 VK_API_VERSION_MINOR(props.apiVersion), VK_API_VERSION_PATCH(props.apiVersion));
+    return true;
+}
+
+bool VulkanBackend::create_device() {
+    uint32_t count = 0;
+    vkEnumerateDeviceExtensionProperties(m_physical_device, nullptr, &count, nullptr);
+    std::vector<VkExtensionProperties> available(count);
+    vkEnumerateDeviceExtensionProperties(m_physical_device, nullptr, &count, available.data());
+
+    std::vector<const char*> extensions{VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+    if (has_extension(available, "VK_KHR_portability_subset")) {
+        extensions.push_back("VK_KHR_portability_subset");
+        m_portability_subset = true;
+    }
+
+    const float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info{};
+    queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_info.queueFamilyIndex = m_queue_family;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+
+    VkDeviceCreateInfo create_info{};
+    create_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    create_info.queueCreateInfoCount = 1;
+    create_info.pQueueCreateInfos = &queue_info;
+    create_info.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+    create_info.ppEnabledExtensionNames = extensions.data();
+
+    VkResult result = vkCreateDevice(m_physical_device, &create_info, nullptr, &m_device);
+    if (result != VK_SUCCESS) {
+        spdlog::error("vkCreateDevice failed: {}", static_cast<int>(result));
+        return false;
+    }
+    vkGetDeviceQueue(m_device, m_queue_family, 0, &m_queue);
+
+    VmaAllocatorCreateInfo allocator_info{};
+    allocator_info.vulkanApiVersion = VK_API_VERSION_1_0;
+    allocator_info.physicalDevice = m_physical_device;
+    allocator_info.device = m_device;
+    allocator_info.instance = m_instance;
+    if (vmaCreateAllocator(&allocator_info, &m_allocator) != VK_SUCCESS) {
+        spdlog::error("vmaCreateAllocator failed");
+        return false;
+    }
+
+    // One pool for ImGui's font and every cached texture descriptor
+    VkDescriptorPoolSize pool_size{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, kMaxTextureDescriptors};
+    VkDescriptorPoolCreateInfo pool_info{};
+    pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    pool_info.maxSets = kMaxTextureDescriptors;
+    pool_info.poolSizeCount = 1;
+    pool_info.pPoolSizes = &pool_size;
+    if (vkCreateDescriptorPool(m_device, &pool_info, nullptr, &m_descriptor_pool) != VK_SUCCESS) {
+        spdlog::error("vkCreateDescriptorPool failed");
+        return false;
+    }
+
+    VkSamplerCreateInfo sampler_info{};
+    sampler_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    sampler_info.magFilter = VK_FILTER_LINEAR;
+    sampler_info.minFilter = VK_FILTER_LINEAR;
+    sampler_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+    sampler_info.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    sampler_info.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    sampler_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    sampler_info.maxLod = VK_LOD_CLAMP_NONE;
+    if (vkCreateSampler(m_device, &sampler_info, nullptr, &m_sampler) != VK_SUCCESS) {
+        spdlog::error("vkCreateSampler failed");
+        return false;
+    }
+
+    return true;
+}
+
+bool VulkanBackend::create_render_pass() {
+    // Surface format: UNORM so colors match the other backends
+    uint32_t count = 0;
+    vkGetPhysicalDeviceSurfaceFormatsKHR(m_physical_device, m_surface, &count, nullptr);
+    std::vector<VkSurfaceFormatKHR> formats(count);
+    vkGetPhysicalDeviceSurfaceFormatsKHR(m_physical_device, m_surface, &count, formats.data());
+    if (formats.empty()) {
+        spdlog::error("Surface reports no formats");
+        return false;
+    }
+
+    m_surface_format = formats[0];
+    for (const auto& f : formats) {
+        if ((f.format == VK_FORMAT_B8G8R8A8_UNORM || f.format == VK_FORMAT_R8G8B8A8_UNORM) &&
+            f.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR) {
+            m_surface_format = f;
+            break;
+        }
+    }
+
+    VkAttachmentDescription attachment{};
+    attachment.format = m_surface_format.format;
+    attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+    VkAttachmentReference color_ref{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+
+    VkSubpassDescription subpass{};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &color_ref;
+
+    VkSubpassDependency dependency{};
+    dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependency.dstSubpass = 0;
+    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+
+    VkRenderPassCreateInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    info.attachmentCount = 1;
+    info.pAttachments = &attachment;
+    info.subpassCount = 1;
+    info.pSubpasses = &subpass;
+    info.dependencyCount = 1;
+    info.pDependencies = &dependency;
+
+    if (vkCreateRenderPass(m_device, &info, nullptr, &m_render_pass) != VK_SUCCESS) {
+        spdlog::error("vkCreateRenderPass failed");
+        return false;
+    }
+    return true;
+}
+
+bool VulkanBackend::create_frames() {
+    for (auto& frame : m_frames) {
+        VkCommandPoolCreateInfo pool_info{};
+        pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        pool_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        pool_info.queueFamilyIndex = m_queue_family;
+        if (vkCreateCommandPool(m_device, &pool_info, nullptr, &frame.command_pool) != VK_SUCCESS) {
+            return false;
+        }
+
+        VkCommandBufferAllocateInfo alloc_info{};
+        alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        alloc_info.commandPool = frame.command_pool;
+        alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_info.commandBufferCount = 1;
+        if (vkAllocateCommandBuffers(m_device, &alloc_info, &frame.command_buffer) != VK_SUCCESS) {
+            return false;
+        }
+
+        VkFenceCreateInfo fence_info{};
+        fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fence_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+        VkSemaphoreCreateInfo semaphore_info{};
+        semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        if (vkCreateFence(m_device, &fence_info, nullptr, &frame.fence) != VK_SUCCESS ||
+            vkCreateSemaphore(m_device, &semaphore_info, nullptr, &frame.image_acquired) != VK_SUCCESS) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool VulkanBackend::create_staging_ring() {
+    VkBufferCreateInfo buffer_info{};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = kStagingRingSize;
+    buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+
+    VmaAllocationCreateInfo alloc_info{};
+    alloc_info.usage = VMA_MEMORY_USAGE_AUTO;
+    alloc_info.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
+                       VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+    VmaAllocationInfo info{};
+    if (vmaCreateBuffer(m_allocator, &buffer_info, &alloc_info,
+                        &m_ring_buffer, &m_ring_allocation, &info) != VK_SUCCESS) {
+        spdlog::error("Failed to allocate {} MiB staging ring", kStagingRingSize >> 20);
+        return false;
+    }
+    m_ring_mapped = static_cast<uint8_t*>(info.pMappedData);
+    return m_ring_mapped != nullptr;
+}
+
+bool VulkanBackend::create_swapchain() {
+    VkSurfaceCapabilitiesKHR caps;
+    vkGetPhysicalDeviceSurfaceCapabilitiesKHR(m_physical_device, m_surface, &caps);
+
+    int width = 0, height = 0;
+    SDL_GetWindowSizeInPixels(m_window, &width, &height);
+    if (caps.currentExtent.width != UINT32_MAX) {
+        m_extent = caps.currentExtent;
+    } else {
+        m_extent.width = std::clamp(static_cast<uint32_t>(std::max(width, 0)),
+                                    caps.minImageExtent.width, caps.maxImageExtent.width);
+        m_extent.height = std::clamp(static_cast<uint32_t>(std::max(height, 0)),
+                                     caps.minImageExtent.height, caps.maxImageExtent.height);
+    }
+    if (m_extent.width == 0 || m_extent.height == 0) {
+        return true;  // Minimized: try again after the next resize
+    }
+
+    m_min_image_count = std::max(2u, caps.minImageCount);
+    uint32_t image_count = m_min_image_count + 1;
+    if (caps.maxImageCount > 0) image_count = std::min(image_count, caps.maxImageCount);
+
+    VkSwapchainCreateInfoKHR info{};
+    info.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+    info.surface = m_surface;
+    info.minImageCount = image_count;
+    info.imageFormat = m_surface_format.format;
+    info.imageColorSpace = m_surface_format.colorSpace;
+    info.imageExtent = m_extent;
+    info.imageArrayLayers = 1;
+    info.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    info.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    info.preTransform = caps.currentTransform;
+    info.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    info.presentMode = VK_PRESENT_MODE_FIFO_KHR;   // VSync, always supported
+    info.clipped = VK_TRUE;
+    info.oldSwapchain = m_swapchain;
+
+    VkSwapchainKHR swapchain = VK_NULL_HANDLE;
+    VkResult result = vkCreateSwapchainKHR(m_device, &info, nullptr, &swapchain);
+    destroy_swapchain_resources();
+    if (m_swapchain) vkDestroySwapchainKHR(m_device, m_swapchain, nullptr);
+    m_swapchain = swapchain;
+    if (result != VK_SUCCESS) {
+        spdlog::error("vkCreateSwapchainKHR failed: {}", static_cast<int>(result));
+        return false;
+    }
+
+    uint32_t count = 0;
+    vkGetSwapchainImagesKHR(m_device, m_swapchain, &count, nullptr);
+    m_swapchain_images.resize(count);
+    vkGetSwapchainImagesKHR(m_device, m_swapchain, &count, m_swapchain_images.data());
+
+    VkSemaphoreCreateInfo semaphore_info{};
+    semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+    for (VkImage image : m_swapchain_images) {
+        VkImageViewCreateInfo view_info{};
+        view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        view_info.image = image;
+        view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        view_info.format = m_surface_format.format;
+        view_info.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+        VkImageView view = VK_NULL_HANDLE;
+        vkCreateImageView(m_device, &view_info, nullptr, &view);
+        m_swapchain_views.push_back(view);
+
+        VkFramebufferCreateInfo fb_info{};
+        fb_info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        fb_info.renderPass = m_render_pass;
+        fb_info.attachmentCount = 1;
+        fb_info.pAttachments = &view;
+        fb_info.width = m_extent.width;
+        fb_info.height = m_extent.height;
+        fb_info.layers = 1;
+        VkFramebuffer framebuffer = VK_NULL_HANDLE;
+        vkCreateFramebuffer(m_device, &fb_info, nullptr, &framebuffer);
+        m_framebuffers.push_back(framebuffer);
+
+        VkSemaphore semaphore = VK_NULL_HANDLE;
+        vkCreateSemaphore(m_device, &semaphore_info, nullptr, &semaphore);
+        m_render_complete.push_back(semaphore);
+    }
+
+    if (m_imgui_initialized) {
+        ImGui_ImplVulkan_SetMinImageCount(m_min_image_count);
+    }
+
+    spdlog::debug("Vulkan swapchain {}x{}, {} images", m_extent.width, m_extent.height, count);
+    return true;
+}
+
+void VulkanBackend::destroy_swapchain_resources() {
+    for (auto framebuffer : m_framebuffers) vkDestroyFramebuffer(m_device, framebuffer, nullptr);
+    for (auto view : m_swapchain_views) vkDestroyImageView(m_device, view, nullptr);
+    for (auto semaphore : m_render_complete) vkDestroySemaphore(m_device, semaphore, nullptr);
+    m_framebuffers.clear();
+    m_swapchain_views.clear();
+    m_render_complete.clear();
+    m_swapchain_images.clear();
+}
+
 // =============================================================================
 // ImGui Integration
 // =============================================================================
 
 void VulkanBackend::imgui_init() {
-    // TODO: ImGui_ImplVulkan_Init
-    spdlog::warn("Vulkan ImGui init not implemented");
+    if (!m_initialized) return;
+
+    ImGui_ImplSDL3_InitForVulkan(m_window);
+
+    ImGui_ImplVulkan_InitInfo init_info{};
+    init_info.Instance = m_instance;
+    init_info.PhysicalDevice = m_physical_device;
+    init_info.Device = m_device;
+    init_info.QueueFamily = m_queue_family;
+    init_info.Queue = m_queue;
+    init_info.DescriptorPool = m_descriptor_pool;
+    init_info.MinImageCount = m_min_image_count;
+    init_info.ImageCount = std::max<uint32_t>(m_min_image_count,
+                                              static_cast<uint32_t>(m_swapchain_images.size()));
+    init_info.CheckVkResultFn = check_vk_result;
+#if IMGUI_VERSION_NUM >= 19220
+    init_info.PipelineInfoMain.RenderPass = m_render_pass;
+    init_info.PipelineInfoMain.MSAASamples = VK_SAMPLE_COUNT_1_BIT;
+#else
+    init_info.RenderPass = m_render_pass;
+    init_info.MSAASamples = VK_SAMPLE_COUNT_1_BIT;
+#endif
+    ImGui_ImplVulkan_Init(&init_info);
+    m_imgui_initialized = true;
+
+    spdlog::debug("ImGui Vulkan backend initialized");
 }
 
 void VulkanBackend::imgui_shutdown() {
-    // TODO: ImGui_ImplVulkan_Shutdown
+    if (!m_imgui_initialized) return;
+
+    vkDeviceWaitIdle(m_device);
+
+    // Cached descriptors belong to the ImGui backend
+    for (auto& [id, tex] : m_textures) {
+        if (tex.descriptor) {
+            ImGui_ImplVulkan_RemoveTexture(tex.descriptor);
+            tex.descriptor = VK_NULL_HANDLE;
+        }
+    }
+    for (auto& garbage : m_pending_garbage) {
+        if (garbage.descriptor) ImGui_ImplVulkan_RemoveTexture(garbage.descriptor);
+        garbage.descriptor = VK_NULL_HANDLE;
+    }
+    for (auto& frame : m_frames) {
+        for (auto& garbage : frame.garbage) {
+            if (garbage.descriptor) ImGui_ImplVulkan_RemoveTexture(garbage.descriptor);
+            garbage.descriptor = VK_NULL_HANDLE;
+        }
+    }
+
+    ImGui_ImplVulkan_Shutdown();
+    ImGui_ImplSDL3_Shutdown();
+    m_imgui_initialized = false;
 }
 
 void VulkanBackend::imgui_new_frame() {
-    // TODO: ImGui_ImplVulkan_NewFrame
+    ImGui_ImplVulkan_NewFrame();
+    ImGui_ImplSDL3_NewFrame();
 }
 
 void VulkanBackend::imgui_render() {
-    // TODO: ImGui_ImplVulkan_RenderDrawData
+    if (!m_frame_active) return;
+
+    FrameData& frame = m_frames[m_frame_index];
+    VkCommandBuffer cmd = frame.command_buffer;
+
+    // Texture copies go first, outside the render pass
+    record_uploads(cmd);
+
+    VkClearValue clear{};
+    clear.color = kClearColor;
+
+    VkRenderPassBeginInfo info{};
+    info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    info.renderPass = m_render_pass;
+    info.framebuffer = m_framebuffers[m_image_index];
+    info.renderArea.extent = m_extent;
+    info.clearValueCount = 1;
+    info.pClearValues = &clear;
+    vkCmdBeginRenderPass(cmd, &info, VK_SUBPASS_CONTENTS_INLINE);
+
+    ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), cmd);
+
+    vkCmdEndRenderPass(cmd);
 }
 
 // =============================================================================
@@ -135,21 +712,120 @@ void VulkanBackend::imgui_render() {
 // =============================================================================
 
 void VulkanBackend::begin_frame() {
-    // TODO: Acquire swapchain image, begin command buffer
+    m_frame_active = false;
+    if (!m_initialized) return;
+
+    if (m_swapchain_rebuild) {
+        vkDeviceWaitIdle(m_device);
+        if (!create_swapchain()) return;
+        m_swapchain_rebuild = false;
+    }
+    if (!m_swapchain || m_framebuffers.empty()) {
+        m_swapchain_rebuild = true;  // Minimized
+        return;
+    }
+
+    FrameData& frame = m_frames[m_frame_index];
+
+    // Frame slot is free again: reclaim its staging space and garbage
+    vkWaitForFences(m_device, 1, &frame.fence, VK_TRUE, UINT64_MAX);
+    release_frame(frame);
+
+    VkResult result = vkAcquireNextImageKHR(m_device, m_swapchain, UINT64_MAX,
+                                            frame.image_acquired, VK_NULL_HANDLE, &m_image_index);
+    if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+        m_swapchain_rebuild = true;
+        return;
+    }
+    if (result == VK_SUBOPTIMAL_KHR) {
+        m_swapchain_rebuild = true;  // Still usable for this frame
+    } else if (result != VK_SUCCESS) {
+        check_vk_result(result);
+        return;
+    }
+
+    vkResetCommandPool(m_device, frame.command_pool, 0);
+    VkCommandBufferBeginInfo begin_info{};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(frame.command_buffer, &begin_info);
+
+    m_frame_active = true;
 }
 
 void VulkanBackend::end_frame() {
-    // TODO: End command buffer
+    if (!m_frame_active) return;
+
+    FrameData& frame = m_frames[m_frame_index];
+    vkEndCommandBuffer(frame.command_buffer);
+
+    // Everything staged or destroyed so far is released with this frame
+    frame.staging_bytes = m_pending_ring_bytes;
+    m_pending_ring_bytes = 0;
+    frame.garbage = std::move(m_pending_garbage);
+    m_pending_garbage.clear();
+
+    const VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    VkSubmitInfo submit{};
+    submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit.waitSemaphoreCount = 1;
+    submit.pWaitSemaphores = &frame.image_acquired;
+    submit.pWaitDstStageMask = &wait_stage;
+    submit.commandBufferCount = 1;
+    submit.pCommandBuffers = &frame.command_buffer;
+    submit.signalSemaphoreCount = 1;
+    submit.pSignalSemaphores = &m_render_complete[m_image_index];
+
+    vkResetFences(m_device, 1, &frame.fence);
+    check_vk_result(vkQueueSubmit(m_queue, 1, &submit, frame.fence));
 }
 
 void VulkanBackend::present() {
-    // TODO: Submit and present
+    if (!m_frame_active) return;
+    m_frame_active = false;
+
+    VkPresentInfoKHR info{};
+    info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+    info.waitSemaphoreCount = 1;
+    info.pWaitSemaphores = &m_render_complete[m_image_index];
+    info.swapchainCount = 1;
+    info.pSwapchains = &m_swapchain;
+    info.pImageIndices = &m_image_index;
+
+    VkResult result = vkQueuePresentKHR(m_queue, &info);
+    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
+        m_swapchain_rebuild = true;
+    } else {
+        check_vk_result(result);
+    }
+
+    m_frame_index = (m_frame_index + 1) % kFramesInFlight;
 }
 
 void VulkanBackend::on_resize(int width, int height) {
-    // TODO: Recreate swapchain
+    // Swapchain is recreated at the start of the next frame
     (void)width;
     (void)height;
+    m_swapchain_rebuild = true;
+}
+
+void VulkanBackend::release_frame(FrameData& frame) {
+    m_ring_used -= std::min(m_ring_used, frame.staging_bytes);
+    frame.staging_bytes = 0;
+
+    for (const auto& garbage : frame.garbage) {
+        destroy_garbage(garbage);
+    }
+    frame.garbage.clear();
+}
+
+void VulkanBackend::destroy_garbage(const Garbage& garbage) {
+    if (garbage.descriptor && m_imgui_initialized) {
+        ImGui_ImplVulkan_RemoveTexture(garbage.descriptor);
+    }
+    if (garbage.view) vkDestroyImageView(m_device, garbage.view, nullptr);
+    if (garbage.image) vmaDestroyImage(m_allocator, garbage.image, garbage.allocation);
+    if (garbage.buffer) vmaDestroyBuffer(m_allocator, garbage.buffer, garbage.allocation);
 }
 
 // =============================================================================
@@ -158,30 +834,342 @@ void VulkanBackend::on_resize(int width, int height) {
 
 TextureHandle
 VulkanBackend::create_texture(const TextureDesc& desc, std::span<const uint8_t> data) {
-    (void)desc;
-    (void)data;
-    // TODO: Create VkImage, VkImageView, VkSampler
-    set_error(BackendError::TextureCreationFailed);
-    return TextureHandle{};  // Invalid handle
+    if (!m_initialized || desc.width == 0 || desc.height == 0) {
+        set_error(m_initialized ? BackendError::TextureCreationFailed : BackendError::InitFailed);
+        return TextureHandle{};  // Invalid handle
+    }
+
+    VkImageCreateInfo image_info{};
+    image_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    image_info.imageType = VK_IMAGE_TYPE_2D;
+    image_info.format = to_vk_format(desc.format);
+    image_info.extent = {desc.width, desc.height, 1};
+    image_info.mipLevels = 1;
+    image_info.arrayLayers = 1;
+    image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_info.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    VmaAllocationCreateInfo alloc_info{};
+    alloc_info.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
+
+    TextureData tex;
+    tex.desc = desc;
+    tex.desc.generate_mips = false;  // Single level; the preview is mipmapped by TiledTexture
+    if (vmaCreateImage(m_allocator, &image_info, &alloc_info,
+                       &tex.image, &tex.allocation, nullptr) != VK_SUCCESS) {
+        spdlog::error("Failed to create {}x{} Vulkan image", desc.width, desc.height);
+        set_error(BackendError::TextureCreationFailed);
+        return TextureHandle{};
+    }
+
+    VkImageViewCreateInfo view_info{};
+    view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    view_info.image = tex.image;
+    view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    view_info.format = image_info.format;
+    view_info.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    if (vkCreateImageView(m_device, &view_info, nullptr, &tex.view) != VK_SUCCESS) {
+        vmaDestroyImage(m_allocator, tex.image, tex.allocation);
+        set_error(BackendError::TextureCreationFailed);
+        return TextureHandle{};
+    }
+
+    TextureHandle handle{m_next_handle_id++};
+    m_textures[handle.id] = tex;
+
+    if (data.empty()) {
+        m_pending_init.push_back(handle.id);
+    } else {
+        update_texture_region(handle, TextureRect{0, 0, desc.width, desc.height}, data);
+    }
+
+    spdlog::debug("Created texture {} ({}x{})", handle.id, desc.width, desc.height);
+
+    clear_error();
+    return handle;
 }
 
 void VulkanBackend::update_texture(TextureHandle handle, std::span<const uint8_t> data) {
-    (void)handle;
-    (void)data;
-    // TODO: Update texture via staging buffer
+    auto it = m_textures.find(handle.id);
+    if (it == m_textures.end()) {
+        spdlog::warn("Attempted to update invalid texture handle: {}", handle.id);
+        return;
+    }
+
+    const auto& desc = it->second.desc;
+    update_texture_region(handle, TextureRect{0, 0, desc.width, desc.height}, data);
+}
+
+void VulkanBackend::update_texture_region(TextureHandle handle, const TextureRect& rect,
+                                          std::span<const uint8_t> data, size_t stride) {
+    auto it = m_textures.find(handle.id);
+    if (it == m_textures.end()) {
+        spdlog::warn("Attempted to update invalid texture handle: {}", handle.id);
+        return;
+    }
+
+    const TextureDesc& desc = it->second.desc;
+    if (!validate_region(desc, rect, data, stride)) return;
+
+    // Images are always 4 bytes per texel
+    const size_t src_bpp = bytes_per_pixel(desc.format);
+    const size_t dst_stride = static_cast<size_t>(rect.width) * 4;
+
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    uint8_t* dst = allocate_staging(dst_stride * rect.height, buffer, offset);
+    if (!dst) return;
+
+    for (uint32_t row = 0; row < rect.height; ++row) {
+        const uint8_t* src_row = data.data() + row * stride;
+        uint8_t* dst_row = dst + row * dst_stride;
+        if (src_bpp == 4) {
+            std::memcpy(dst_row, src_row, dst_stride);
+        } else {
+            for (uint32_t x = 0; x < rect.width; ++x) {
+                dst_row[x * 4 + 0] = src_row[x * 3 + 0];
+                dst_row[x * 4 + 1] = src_row[x * 3 + 1];
+                dst_row[x * 4 + 2] = src_row[x * 3 + 2];
+                dst_row[x * 4 + 3] = 255;
+            }
+        }
+    }
+
+    queue_copy(handle.id, buffer, offset, rect);
+}
+
+TextureUpload VulkanBackend::map_texture_region(TextureHandle handle, const TextureRect& rect) {
+    auto it = m_textures.find(handle.id);
+    const TextureDesc* desc = (it == m_textures.end()) ? nullptr : &it->second.desc;
+
+    // 3-channel formats need expansion: stage in system memory instead
+    if (!desc || bytes_per_pixel(desc->format) != 4) {
+        TextureUpload upload = IRenderBackend::map_texture_region(handle, rect);
+        upload.slot = kStagingSlot;
+        return upload;
+    }
+    if (rect.empty() || rect.x + rect.width > desc->width || rect.y + rect.height > desc->height) {
+        return TextureUpload{};
+    }
+
+    TextureUpload upload;
+    upload.handle = handle;
+    upload.rect = rect;
+    upload.stride = static_cast<size_t>(rect.width) * 4;
+    upload.slot = kRingSlot;
+    upload.data = allocate_staging(upload.stride * rect.height, m_mapped_buffer, m_mapped_offset);
+    return upload;
+}
+
+void VulkanBackend::commit_texture_region(const TextureUpload& upload) {
+    if (!upload.valid()) return;
+    if (upload.slot == kStagingSlot) {
+        IRenderBackend::commit_texture_region(upload);
+        return;
+    }
+
+    // Texture may have been destroyed while mapped; the staging space is
+    // still reclaimed with the next frame
+    if (m_textures.count(upload.handle.id)) {
+        queue_copy(upload.handle.id, m_mapped_buffer, m_mapped_offset, upload.rect);
+    }
+    m_mapped_buffer = VK_NULL_HANDLE;
 }
 
 void VulkanBackend::destroy_texture(TextureHandle handle) {
-    m_textures.erase(handle.id);
-    // TODO: Destroy Vulkan resources
+    auto it = m_textures.find(handle.id);
+    if (it == m_textures.end()) {
+        return;
+    }
+
+    // Drop queued uploads; the GPU may still be sampling the image, so the
+    // resources are released with the next frame
+    std::erase_if(m_pending_copies, [&](const PendingCopy& c) { return c.texture_id == handle.id; });
+    std::erase(m_pending_init, handle.id);
+
+    const TextureData& tex = it->second;
+    m_pending_garbage.push_back(Garbage{tex.image, tex.allocation, tex.view, tex.descriptor});
+    m_textures.erase(it);
+
+    spdlog::debug("Destroyed texture {}", handle.id);
 }
 
 void* VulkanBackend::get_imgui_texture_id(TextureHandle handle) const {
     auto it = m_textures.find(handle.id);
-    if (it == m_textures.end()) {
+    if (it == m_textures.end() || !m_imgui_initialized) {
         return nullptr;
     }
-    return it->second;  // TODO: Return VkDescriptorSet
+
+    // Descriptor set is created once and cached with the texture
+    const TextureData& tex = it->second;
+    if (!tex.descriptor) {
+        tex.descriptor = ImGui_ImplVulkan_AddTexture(m_sampler, tex.view,
+                                                     VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
+    return reinterpret_cast<void*>(tex.descriptor);
+}
+
+const TextureDesc* VulkanBackend::texture_desc(TextureHandle handle) const {
+    auto it = m_textures.find(handle.id);
+    return it == m_textures.end() ? nullptr : &it->second.desc;
+}
+
+// =============================================================================
+// Uploads
+// =============================================================================
+
+uint8_t* VulkanBackend::allocate_staging(VkDeviceSize size, VkBuffer& buffer, VkDeviceSize& offset) {
+    // Ring: allocations are released in submission order, so a head and a
+    // used-byte count suffice; bytes skipped when wrapping count as used
+    VkDeviceSize start = (m_ring_head + m_ring_alignment - 1) / m_ring_alignment * m_ring_alignment;
+    VkDeviceSize need = start - m_ring_head + size;
+    if (start + size > kStagingRingSize) {
+        start = 0;
+        need = kStagingRingSize - m_ring_head + size;
+    }
+
+    if (m_ring_used + need <= kStagingRingSize) {
+        m_ring_head = start + size;
+        m_ring_used += need;
+        m_pending_ring_bytes += need;
+        buffer = m_ring_buffer;
+        offset = start;
+        return m_ring_mapped + start;
+    }
+
+    // Ring exhausted (or upload larger than it): one-off buffer, freed with the frame
+    VkBufferCreateInfo buffer_info{};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = size;
+    buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+
+    VmaAllocationCreateInfo alloc_info{};
+    alloc_info.usage = VMA_MEMORY_USAGE_AUTO;
+    alloc_info.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
+                       VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+    Garbage temp;
+    VmaAllocationInfo info{};
+    if (vmaCreateBuffer(m_allocator, &buffer_info, &alloc_info,
+                        &temp.buffer, &temp.allocation, &info) != VK_SUCCESS) {
+        spdlog::error("Failed to allocate {} KiB staging buffer", size >> 10);
+        return nullptr;
+    }
+    spdlog::debug("Staging ring full, using a {} KiB temporary buffer", size >> 10);
+
+    m_pending_garbage.push_back(temp);
+    buffer = temp.buffer;
+    offset = 0;
+    return static_cast<uint8_t*>(info.pMappedData);
+}
+
+void VulkanBackend::queue_copy(uint64_t texture_id, VkBuffer buffer, VkDeviceSize offset,
+                               const TextureRect& rect) {
+    // Host writes must be visible before the copy (no-op on coherent memory)
+    const VkDeviceSize bytes = static_cast<VkDeviceSize>(rect.width) * rect.height * 4;
+    note_upload(bytes);
+    if (buffer == m_ring_buffer) {
+        vmaFlushAllocation(m_allocator, m_ring_allocation, offset, bytes);
+    } else {
+        auto it = std::find_if(m_pending_garbage.begin(), m_pending_garbage.end(),
+                               [&](const Garbage& g) { return g.buffer == buffer; });
+        if (it != m_pending_garbage.end()) vmaFlushAllocation(m_allocator, it->allocation, 0, bytes);
+    }
+
+    PendingCopy copy;
+    copy.texture_id = texture_id;
+    copy.buffer = buffer;
+    copy.region.bufferOffset = offset;
+    copy.region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copy.region.imageOffset = {static_cast<int32_t>(rect.x), static_cast<int32_t>(rect.y), 0};
+    copy.region.imageExtent = {rect.width, rect.height, 1};
+    m_pending_copies.push_back(copy);
+}
+
+void VulkanBackend::record_uploads(VkCommandBuffer cmd) {
+    if (m_pending_copies.empty() && m_pending_init.empty()) return;
+
+    // Group by image and buffer so each pair is a single copy command
+    std::stable_sort(m_pending_copies.begin(), m_pending_copies.end(),
+                     [](const PendingCopy& a, const PendingCopy& b) {
+                         return a.texture_id != b.texture_id ? a.texture_id < b.texture_id
+                                                             : a.buffer < b.buffer;
+                     });
+
+    auto make_barrier = [](VkImage image, VkImageLayout from, VkImageLayout to,
+                           VkAccessFlags src, VkAccessFlags dst) {
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcAccessMask = src;
+        barrier.dstAccessMask = dst;
+        barrier.oldLayout = from;
+        barrier.newLayout = to;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image;
+        barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+        return barrier;
+    };
+
+    std::vector<VkImageMemoryBarrier> to_transfer;
+    std::vector<VkImageMemoryBarrier> to_shader;
+
+    for (size_t i = 0; i < m_pending_copies.size(); ++i) {
+        if (i > 0 && m_pending_copies[i].texture_id == m_pending_copies[i - 1].texture_id) continue;
+        TextureData& tex = m_textures.at(m_pending_copies[i].texture_id);
+        to_transfer.push_back(make_barrier(
+            tex.image, tex.layout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            0, VK_ACCESS_TRANSFER_WRITE_BIT));
+        to_shader.push_back(make_barrier(
+            tex.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT));
+        tex.layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    }
+
+    // Created without data and never uploaded: make them sampleable anyway
+    for (uint64_t id : m_pending_init) {
+        auto it = m_textures.find(id);
+        if (it == m_textures.end() || it->second.layout != VK_IMAGE_LAYOUT_UNDEFINED) continue;
+        to_shader.push_back(make_barrier(
+            it->second.image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            0, VK_ACCESS_SHADER_READ_BIT));
+        it->second.layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    }
+
+    if (!to_transfer.empty()) {
+        // Previous frames may still sample these images
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr,
+                             static_cast<uint32_t>(to_transfer.size()), to_transfer.data());
+    }
+
+    std::vector<VkBufferImageCopy> regions;
+    for (size_t i = 0; i < m_pending_copies.size();) {
+        const PendingCopy& first = m_pending_copies[i];
+        regions.clear();
+        size_t j = i;
+        for (; j < m_pending_copies.size() &&
+               m_pending_copies[j].texture_id == first.texture_id &&
+               m_pending_copies[j].buffer == first.buffer; ++j) {
+            regions.push_back(m_pending_copies[j].region);
+        }
+        vkCmdCopyBufferToImage(cmd, first.buffer, m_textures.at(first.texture_id).image,
+                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                               static_cast<uint32_t>(regions.size()), regions.data());
+        i = j;
+    }
+
+    if (!to_shader.empty()) {
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                             VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr,
+                             static_cast<uint32_t>(to_shader.size()), to_shader.data());
+    }
+
+    m_pending_copies.clear();
+    m_pending_init.clear();
 }
 
 // =============================================================================
@@ -189,7 +1177,7 @@ void* VulkanBackend::get_imgui_texture_id(TextureHandle handle) const {
 // =============================================================================
 
 std::string_view VulkanBackend::name() const noexcept {
-    return "Vulkan 1.2 (Stub)";
+    return "Vulkan 1.2";
 }
 
 }  // namespace gwt::gui
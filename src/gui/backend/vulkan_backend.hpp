@@ -3,6 +3,17 @@
  * @brief   Vulkan Render Backend (Optional)
  * @author  AllenK (Kwyshell)
  * @license MIT
+ *
+ * @details
+ * Texture uploads never submit work of their own: pixel data is written
+ * into a persistently mapped staging ring (VMA), and the buffer-to-image
+ * copies of a frame are recorded in one batch at the start of that
+ * frame's command buffer, bracketed by a single pair of layout barriers.
+ * Ring space is reclaimed when the frame's fence signals; uploads that do
+ * not fit fall back to a temporary staging buffer freed the same way.
+ *
+ * Physical device selection accepts CPU implementations, so the backend
+ * runs on lavapipe (e.g. VK_DRIVER_FILES=.../lvp_icd.x86_64.json).
  */
 
 #pragma once
@@ -11,8 +22,13 @@
 
 #include "gui/backend/render_backend.hpp"
 
+#include <vulkan/vulkan.h>
+#include <vk_mem_alloc.h>
+
+#include <array>
 #include <unordered_map>
 #include <cstdint>
+#include <vector>
 
 // Forward declarations
 struct SDL_Window;
@@ -32,15 +48,15 @@ public:
     // ==========================================================================
     // Lifecycle
     // ==========================================================================
-    
+
     [[nodiscard]] bool init(SDL_Window* window) override;
-    
+
     void shutdown() override;
 
     // ==========================================================================
     // ImGui Integration
     // ==========================================================================
-    
+
     void imgui_init() override;
     void imgui_shutdown() override;
     void imgui_new_frame() override;
@@ -49,7 +65,7 @@ public:
     // ==========================================================================
     // Frame Management
     // ==========================================================================
-    
+
     void begin_frame() override;
     void end_frame() override;
     void present() override;
@@ -58,34 +74,146 @@ public:
     // ==========================================================================
     // Texture Operations
     // ==========================================================================
-    
+
     [[nodiscard]] TextureHandle
     create_texture(const TextureDesc& desc, std::span<const uint8_t> data = {}) override;
-    
+
     void update_texture(TextureHandle handle, std::span<const uint8_t> data) override;
+    void update_texture_region(TextureHandle handle, const TextureRect& rect,
+                               std::span<const uint8_t> data, size_t stride = 0) override;
     void destroy_texture(TextureHandle handle) override;
-    
+
+    [[nodiscard]] TextureUpload map_texture_region(TextureHandle handle,
+                                                   const TextureRect& rect) override;
+    void commit_texture_region(const TextureUpload& upload) override;
+
     [[nodiscard]] void* get_imgui_texture_id(TextureHandle handle) const override;
+    [[nodiscard]] const TextureDesc* texture_desc(TextureHandle handle) const override;
 
     // ==========================================================================
     // Backend Info
     // ==========================================================================
-    
+
     [[nodiscard]] std::string_view name() const noexcept override;
     [[nodiscard]] BackendType type() const noexcept override { return BackendType::Vulkan; }
     [[nodiscard]] bool supports_compute() const noexcept override { return true; }
 
 private:
-    // TODO: Vulkan handles and resources
-    // VkInstance m_instance{VK_NULL_HANDLE};
-    // VkDevice m_device{VK_NULL_HANDLE};
-    // VkPhysicalDevice m_physical_device{VK_NULL_HANDLE};
-    // ...
+    static constexpr uint32_t kFramesInFlight = 2;
+    static constexpr VkDeviceSize kStagingRingSize = 64ull * 1024 * 1024;
+    static constexpr uint32_t kMaxTextureDescriptors = 1024;
+    static constexpr uint32_t kRingSlot = 0;
+    static constexpr uint32_t kStagingSlot = ~0u;  // Upload mapped by the base class
+
+    struct TextureData {
+        TextureDesc desc;
+        VkImage image{VK_NULL_HANDLE};
+        VmaAllocation allocation{VK_NULL_HANDLE};
+        VkImageView view{VK_NULL_HANDLE};
+        VkImageLayout layout{VK_IMAGE_LAYOUT_UNDEFINED};
+        mutable VkDescriptorSet descriptor{VK_NULL_HANDLE};  // Created on first use by ImGui
+    };
+
+    /**
+     * Copy recorded at the start of the next frame
+     */
+    struct PendingCopy {
+        uint64_t texture_id{0};
+        VkBuffer buffer{VK_NULL_HANDLE};
+        VkBufferImageCopy region{};
+    };
+
+    /**
+     * Resources released once the frame that last used them has completed
+     */
+    struct Garbage {
+        VkImage image{VK_NULL_HANDLE};
+        VmaAllocation allocation{VK_NULL_HANDLE};
+        VkImageView view{VK_NULL_HANDLE};
+        VkDescriptorSet descriptor{VK_NULL_HANDLE};
+        VkBuffer buffer{VK_NULL_HANDLE};
+    };
+
+    struct FrameData {
+        VkCommandPool command_pool{VK_NULL_HANDLE};
+        VkCommandBuffer command_buffer{VK_NULL_HANDLE};
+        VkFence fence{VK_NULL_HANDLE};
+        VkSemaphore image_acquired{VK_NULL_HANDLE};
+        VkDeviceSize staging_bytes{0};      // Ring bytes to release when the fence signals
+        std::vector<Garbage> garbage;
+    };
+
+    // Setup helpers
+    bool create_instance();
+    bool select_physical_device();
+    bool create_device();
+    bool create_render_pass();
+    bool create_frames();
+    bool create_staging_ring();
+    bool create_swapchain();
+    void destroy_swapchain_resources();
+
+    // Frame helpers
+    void release_frame(FrameData& frame);
+    void destroy_garbage(const Garbage& garbage);
+
+    // Upload helpers
+    uint8_t* allocate_staging(VkDeviceSize size, VkBuffer& buffer, VkDeviceSize& offset);
+    void queue_copy(uint64_t texture_id, VkBuffer buffer, VkDeviceSize offset,
+                    const TextureRect& rect);
+    void record_uploads(VkCommandBuffer cmd);
 
     SDL_Window* m_window{nullptr};
     bool m_initialized{false};
-    
-    std::unordered_map<uint64_t, void*> m_textures;  // TODO: proper texture struct
+    bool m_imgui_initialized{false};
+
+    // Device
+    VkInstance m_instance{VK_NULL_HANDLE};
+    VkSurfaceKHR m_surface{VK_NULL_HANDLE};
+    VkPhysicalDevice m_physical_device{VK_NULL_HANDLE};
+    VkDevice m_device{VK_NULL_HANDLE};
+    uint32_t m_queue_family{0};
+    VkQueue m_queue{VK_NULL_HANDLE};
+    VmaAllocator m_allocator{VK_NULL_HANDLE};
+    VkDescriptorPool m_descriptor_pool{VK_NULL_HANDLE};
+    VkSampler m_sampler{VK_NULL_HANDLE};
+    bool m_portability_subset{false};
+
+    // Swapchain
+    VkSurfaceFormatKHR m_surface_format{};
+    VkRenderPass m_render_pass{VK_NULL_HANDLE};
+    VkSwapchainKHR m_swapchain{VK_NULL_HANDLE};
+    VkExtent2D m_extent{};
+    uint32_t m_min_image_count{2};
+    std::vector<VkImage> m_swapchain_images;
+    std::vector<VkImageView> m_swapchain_views;
+    std::vector<VkFramebuffer> m_framebuffers;
+    std::vector<VkSemaphore> m_render_complete;     // Per swapchain image
+    bool m_swapchain_rebuild{false};
+
+    // Frames in flight
+    std::array<FrameData, kFramesInFlight> m_frames;
+    uint32_t m_frame_index{0};
+    uint32_t m_image_index{0};
+    bool m_frame_active{false};             // Image acquired, command buffer recording
+
+    // Staging ring (persistently mapped, allocations released in frame order)
+    VkBuffer m_ring_buffer{VK_NULL_HANDLE};
+    VmaAllocation m_ring_allocation{VK_NULL_HANDLE};
+    uint8_t* m_ring_mapped{nullptr};
+    VkDeviceSize m_ring_head{0};
+    VkDeviceSize m_ring_used{0};
+    VkDeviceSize m_ring_alignment{4};
+    VkDeviceSize m_pending_ring_bytes{0};   // Not yet assigned to a submitted frame
+
+    // Work for the next submitted frame
+    std::vector<PendingCopy> m_pending_copies;
+    std::vector<uint64_t> m_pending_init;   // Textures created without data
+    std::vector<Garbage> m_pending_garbage;
+    VkBuffer m_mapped_buffer{VK_NULL_HANDLE};   // Outstanding map_texture_region()
+    VkDeviceSize m_mapped_offset{0};
+
+    std::unordered_map<uint64_t, TextureData> m_textures;
     uint64_t m_next_handle_id{1};
 };
 
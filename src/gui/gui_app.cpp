@@ -8,6 +8,7 @@
 #include "gui/gui_app.hpp"
 #include "gui/backend/render_backend.hpp"
 #include "gui/app/app_controller.hpp"
+#include "gui/app/gui_benchmark.hpp"
 #include "gui/widgets/main_window.hpp"
 #include "gui/resources/style.hpp"
 
@@ -36,11 +37,17 @@ constexpr int kMinWidth = 1030;
 constexpr int kMinHeight = 888;
 constexpr const char* kWindowTitle = "Gemini Watermark Tool";
 
+// Frame scheduling
+constexpr Uint64 kActiveLingerMs = 1000;    // Full rate after the last event (hover delays, settling)
+constexpr Sint32 kIdleWaitMs = 1000;        // Longest block while idle
+constexpr Sint32 kTextInputWaitMs = 500;    // Keeps the text cursor blinking
+
 // Parse backend type from command line
 BackendType parse_backend_arg(int argc, char** argv) {
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
         if (arg == "--backend=opengl") return BackendType::OpenGL;
+        if (arg == "--backend=null") return BackendType::Null;
 #if defined(_WIN32)
         if (arg == "--backend=d3d11") return BackendType::D3D11;
 #endif
@@ -66,6 +73,11 @@ int run(int argc, char** argv) {
 
     spdlog::info("Starting Gemini Watermark Tool GUI v{}", APP_VERSION);
 
+    // Headless benchmark: no SDL window, Null backend
+    if (is_gui_benchmark(argc, argv)) {
+        return run_gui_benchmark(argc, argv);
+    }
+
     // Initialize SDL
     if (!SDL_Init(SDL_INIT_VIDEO)) {
         spdlog::error("Failed to initialize SDL: {}", SDL_GetError());
@@ -339,6 +351,14 @@ int run(int argc, char** argv) {
     controller.state().dpi_scale = dpi_scale;  // Store for widgets to use
     MainWindow main_window(controller);
 
+    // Workers wake the main loop when they post results
+    const Uint32 wake_event = SDL_RegisterEvents(1);
+    controller.set_wake_callback([wake_event] {
+        SDL_Event event{};
+        event.type = wake_event;
+        SDL_PushEvent(&event);
+    });
+
     // Structure to pass to event watch callback
     struct RenderContext {
         IRenderBackend* backend;
@@ -391,13 +411,24 @@ int run(int argc, char** argv) {
         }
     }
 
-    // Main loop
+    // Main loop: renders at full rate while the user interacts or work is
+    // running, and blocks in SDL_WaitEventTimeout when nothing changes
     bool running = true;
+    Uint64 last_activity = SDL_GetTicks();
 
     while (running) {
-        // Process events
+        const bool active = controller.wants_continuous_update() ||
+                            SDL_GetTicks() - last_activity < kActiveLingerMs;
+
         SDL_Event event;
-        while (SDL_PollEvent(&event)) {
+        bool has_event = active
+            ? SDL_PollEvent(&event)
+            : SDL_WaitEventTimeout(&event, io.WantTextInput ? kTextInputWaitMs : kIdleWaitMs);
+
+        // Process events
+        for (; has_event; has_event = SDL_PollEvent(&event)) {
+            last_activity = SDL_GetTicks();
+
             // Let ImGui process the event first
             ImGui_ImplSDL3_ProcessEvent(&event);
 
@@ -420,7 +451,9 @@ int run(int argc, char** argv) {
 
                 default:
                     // Let main window handle other events
-                    main_window.handle_event(event);
+                    if (event.type != wake_event) {
+                        main_window.handle_event(event);
+                    }
                     break;
             }
         }
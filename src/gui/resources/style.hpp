@@ -198,7 +198,9 @@ namespace batch_theme {
     // Grid layout
     constexpr int kThumbnailCols       = 4;       // Thumbnails per row
     constexpr int kThumbnailCellSize   = 220;     // Cell size in pixels
-    constexpr int kThumbnailMaxCount   = 32;      // Max thumbnails to display
+    constexpr int kThumbnailSlotCols   = 8;       // Slot pool atlas: 8x8 resident thumbnails,
+    constexpr int kThumbnailSlotRows   = 8;       // recycled while scrolling
+    constexpr int kThumbnailLookahead  = 2;       // Rows decoded above/below the visible ones
 
     // Spacing & padding (in atlas pixels)
     constexpr int kCellPadding         = 6;       // Padding inside each cell
@@ -221,6 +223,7 @@ namespace batch_theme {
     constexpr ImU32 kOverlaySkip       = IM_COL32(100, 100, 100, 120);
     constexpr ImU32 kOverlayFail       = IM_COL32(200, 0, 0, 70);
     constexpr ImU32 kOverlayProcessing = IM_COL32(255, 200, 0, 50);
+    constexpr ImU32 kOverlayDeselected = IM_COL32(0, 0, 0, 140);
 
     constexpr ImU32 kIconOK            = IM_COL32(100, 255, 100, 255);
     constexpr ImU32 kIconSkip          = IM_COL32(180, 180, 180, 255);
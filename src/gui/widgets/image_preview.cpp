@@ -45,7 +45,8 @@ void ImagePreview::render_placeholder() {
     ImVec2 content_start = ImGui::GetCursorScreenPos();
 
     // Draw placeholder text centered
-    const char* text = "Drop an image here or click Open";
+    const bool loading = m_controller.state().state == ProcessState::Loading;
+    const char* text = loading ? "Loading..." : "Drop an image here or click Open";
     ImVec2 text_size = ImGui::CalcTextSize(text);
 
     ImVec2 text_pos(
@@ -84,128 +85,176 @@ void ImagePreview::render_batch_view() {
     ImDrawList* draw_list = ImGui::GetWindowDrawList();
     float outer_pad = 10.0f;
 
-    // --- Thumbnail Atlas ---
-    if (batch.thumbnails_ready && batch.thumbnail_texture.valid()) {
-        void* tex_id = m_controller.get_batch_thumbnail_texture_id();
-        
-        if (tex_id) {
-            // Atlas actual pixel size (includes vertical gaps)
-            float atlas_w = static_cast<float>(batch.thumbnail_cols * kThumbnailCellSize);
-            float atlas_h = static_cast<float>(
-                batch.thumbnail_rows * kThumbnailCellSize
-                + (batch.thumbnail_rows > 0 ? (batch.thumbnail_rows - 1) * kCellGapV : 0));
-
-            // Scale atlas to fit width, but don't upscale
-            float atlas_scale = std::min(1.0f, (avail.x - outer_pad * 2) / atlas_w);
-            float display_w = atlas_w * atlas_scale;
-            float display_h = atlas_h * atlas_scale;
-
-            // Center horizontally
-            float offset_x = (avail.x - display_w) * 0.5f;
-            ImGui::SetCursorPosX(offset_x);
-
-            ImVec2 atlas_pos = ImGui::GetCursorScreenPos();
-
-            ImGui::Image(reinterpret_cast<ImTextureID>(tex_id),
-                        ImVec2(display_w, display_h));
-
-            // Draw status overlays + filename labels
-            int max_thumbs = std::min(static_cast<int>(batch.files.size()), kThumbnailMaxCount);
-            float cell_w = static_cast<float>(kThumbnailCellSize) * atlas_scale;
-            float cell_h = static_cast<float>(kThumbnailCellSize) * atlas_scale;
-            float gap_v_scaled = static_cast<float>(kCellGapV) * atlas_scale;
-            float label_h_scaled = static_cast<float>(kLabelHeight) * atlas_scale;
-
-            for (int i = 0; i < max_thumbs; ++i) {
-                int col = i % batch.thumbnail_cols;
-                int row = i / batch.thumbnail_cols;
-
-                ImVec2 cell_tl(atlas_pos.x + col * cell_w,
-                              atlas_pos.y + row * (cell_h + gap_v_scaled));
-                ImVec2 cell_br(cell_tl.x + cell_w, cell_tl.y + cell_h);
-
-                const auto& file = batch.files[i];
-
-                // Status overlay
-                ImU32 overlay_color = IM_COL32(0, 0, 0, 0);
-                const char* icon = nullptr;
-                ImU32 icon_color = kIconDefault;
-
-                switch (file.status) {
-                    case BatchFileStatus::OK:
-                        overlay_color = kOverlayOK;
-                        icon = "OK";
-                        icon_color = kIconOK;
-                        break;
-                    case BatchFileStatus::Skipped:
-                        overlay_color = kOverlaySkip;
-                        icon = "SKIP";
-                        icon_color = kIconSkip;
-                        break;
-                    case BatchFileStatus::Failed:
-                        overlay_color = kOverlayFail;
-                        icon = "FAIL";
-                        icon_color = kIconFail;
-                        break;
-                    case BatchFileStatus::Processing:
-                        overlay_color = kOverlayProcessing;
-                        icon = "...";
-                        break;
-                    default:
-                        break;
-                }
+    // --- Thumbnail Grid ---
+    // Only the visible rows are laid out; their thumbnails live in a
+    // fixed pool of texture slots the controller fills on demand
+    void* tex_id = batch.thumbnail_texture.valid()
+                 ? m_controller.get_batch_thumbnail_texture_id() : nullptr;
+    if (tex_id && !batch.files.empty()) {
+        const int file_count = static_cast<int>(batch.files.size());
+        const int row_count = (file_count + kThumbnailCols - 1) / kThumbnailCols;
+
+        // Scale grid to fit width, but don't upscale
+        float grid_w = static_cast<float>(kThumbnailCols * kThumbnailCellSize);
+        float grid_scale = std::min(1.0f, (avail.x - outer_pad * 2) / grid_w);
+        float display_w = grid_w * grid_scale;
+
+        float cell_w = static_cast<float>(kThumbnailCellSize) * grid_scale;
+        float cell_h = static_cast<float>(kThumbnailCellSize) * grid_scale;
+        float gap_v_scaled = static_cast<float>(kCellGapV) * grid_scale;
+        float label_h_scaled = static_cast<float>(kLabelHeight) * grid_scale;
+        float row_h = cell_h + gap_v_scaled;
+
+        // Center horizontally
+        float offset_x = (avail.x - display_w) * 0.5f;
+
+        ImGuiListClipper clipper;
+        clipper.Begin(row_count, row_h);
+        int first_row = row_count;
+        int last_row = 0;
+
+        while (clipper.Step()) {
+            first_row = std::min(first_row, clipper.DisplayStart);
+            last_row = std::max(last_row, clipper.DisplayEnd);
+
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                ImGui::SetCursorPosX(offset_x);
+                ImVec2 row_pos = ImGui::GetCursorScreenPos();
+                ImGui::Dummy(ImVec2(display_w, row_h));
+
+                for (int col = 0; col < kThumbnailCols; ++col) {
+                    const int i = row * kThumbnailCols + col;
+                    if (i >= file_count) break;
+
+                    ImVec2 cell_tl(row_pos.x + col * cell_w, row_pos.y);
+                    ImVec2 cell_br(cell_tl.x + cell_w, cell_tl.y + cell_h);
+
+                    // Thumbnail, or an empty cell until it is decoded
+                    if (auto uv = m_controller.thumbnail_uv(static_cast<size_t>(i))) {
+                        draw_list->AddImage(reinterpret_cast<ImTextureID>(tex_id),
+                            cell_tl, cell_br,
+                            ImVec2(uv->x, uv->y),
+                            ImVec2(uv->x + uv->width, uv->y + uv->height));
+                    } else {
+                        const float pad = static_cast<float>(kCellPadding) * grid_scale;
+                        draw_list->AddRectFilled(
+                            ImVec2(cell_tl.x + pad, cell_tl.y + pad),
+                            ImVec2(cell_br.x - pad, cell_br.y - pad),
+                            IM_COL32(kCellBgR, kCellBgG, kCellBgB, kCellBgA));
+                    }
 
-                if (overlay_color != IM_COL32(0, 0, 0, 0)) {
-                    draw_list->AddRectFilled(cell_tl, cell_br, overlay_color);
-                }
-                if (icon) {
-                    ImVec2 text_sz = ImGui::CalcTextSize(icon);
-                    draw_list->AddText(
-                        ImVec2(cell_tl.x + (cell_w - text_sz.x) * 0.5f,
-                               cell_tl.y + (cell_h - label_h_scaled - text_sz.y) * 0.5f),
-                        icon_color, icon);
-                }
+                    const auto& file = batch.files[i];
+
+                    // Status overlay
+                    ImU32 overlay_color = IM_COL32(0, 0, 0, 0);
+                    const char* icon = nullptr;
+                    ImU32 icon_color = kIconDefault;
+
+                    switch (file.status) {
+                        case BatchFileStatus::OK:
+                            overlay_color = kOverlayOK;
+                            icon = "OK";
+                            icon_color = kIconOK;
+                            break;
+                        case BatchFileStatus::Skipped:
+                            overlay_color = kOverlaySkip;
+                            icon = "SKIP";
+                            icon_color = kIconSkip;
+                            break;
+                        case BatchFileStatus::Failed:
+                            overlay_color = kOverlayFail;
+                            icon = "FAIL";
+                            icon_color = kIconFail;
+                            break;
+                        case BatchFileStatus::Processing:
+                            overlay_color = kOverlayProcessing;
+                            icon = "...";
+                            break;
+                        case BatchFileStatus::Pending:
+                            if (!file.selected) {
+                                overlay_color = kOverlayDeselected;
+                                icon = "OFF";
+                                icon_color = kIconSkip;
+                            }
+                            break;
+                        default:
+                            break;
+                    }
 
-                // Filename label at bottom of cell
-                std::string filename = file.path.filename().string();
-                float max_label_w = cell_w - 6.0f;
-                std::string display_name = filename;
-                ImVec2 name_sz = ImGui::CalcTextSize(display_name.c_str());
-                if (name_sz.x > max_label_w && display_name.size() > 12) {
-                    std::string ext = file.path.extension().string();
-                    size_t keep = std::max(static_cast<size_t>(6),
-                                           display_name.size() - ext.size());
-                    while (keep > 3) {
-                        display_name = filename.substr(0, keep) + ".." + ext;
-                        name_sz = ImGui::CalcTextSize(display_name.c_str());
-                        if (name_sz.x <= max_label_w) break;
-                        keep--;
+                    if (overlay_color != IM_COL32(0, 0, 0, 0)) {
+                        draw_list->AddRectFilled(cell_tl, cell_br, overlay_color);
+                    }
+                    if (icon) {
+                        ImVec2 text_sz = ImGui::CalcTextSize(icon);
+                        draw_list->AddText(
+                            ImVec2(cell_tl.x + (cell_w - text_sz.x) * 0.5f,
+                                   cell_tl.y + (cell_h - label_h_scaled - text_sz.y) * 0.5f),
+                            icon_color, icon);
                     }
-                }
 
-                // Label background
-                ImVec2 label_tl(cell_tl.x, cell_br.y - label_h_scaled);
-                ImVec2 label_br(cell_br.x, cell_br.y);
-                draw_list->AddRectFilled(label_tl, label_br,
-                    IM_COL32(kLabelBgR, kLabelBgG, kLabelBgB, kLabelBgA));
-
-                // Label text centered
-                name_sz = ImGui::CalcTextSize(display_name.c_str());
-                draw_list->AddText(
-                    ImVec2(cell_tl.x + (cell_w - name_sz.x) * 0.5f,
-                           label_tl.y + (label_h_scaled - name_sz.y) * 0.5f),
-                    IM_COL32(kLabelTextR, kLabelTextG, kLabelTextB, kLabelTextA),
-                    display_name.c_str());
-            }
+                    // Pre-scan confidence (top-left)
+                    if (file.scanned) {
+                        char badge[16];
+                        snprintf(badge, sizeof(badge), "%.0f%%", file.confidence * 100.0f);
+                        const float inset = static_cast<float>(kCellPadding) * grid_scale + 2.0f;
+                        ImVec2 badge_sz = ImGui::CalcTextSize(badge);
+                        ImVec2 badge_tl(cell_tl.x + inset, cell_tl.y + inset);
+                        draw_list->AddRectFilled(badge_tl,
+                            ImVec2(badge_tl.x + badge_sz.x + 6.0f, badge_tl.y + badge_sz.y + 2.0f),
+                            IM_COL32(kLabelBgR, kLabelBgG, kLabelBgB, kLabelBgA));
+                        draw_list->AddText(ImVec2(badge_tl.x + 3.0f, badge_tl.y + 1.0f),
+                            file.selected ? kIconOK : kIconSkip, badge);
+                    }
 
-            // "[+N more...]" indicator
-            if (batch.files.size() > static_cast<size_t>(kThumbnailMaxCount)) {
-                ImGui::Spacing();
-                ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f),
-                                  "[+%zu more files...]",
-                                  batch.files.size() - kThumbnailMaxCount);
+                    // Click to include/exclude before processing
+                    if (!batch.in_progress && ImGui::IsWindowHovered() &&
+                        ImGui::IsMouseHoveringRect(cell_tl, cell_br) &&
+                        ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+                        m_controller.toggle_batch_file(static_cast<size_t>(i));
+                    }
+
+                    // Filename label at bottom of cell
+                    std::string filename = file.path.filename().string();
+                    float max_label_w = cell_w - 6.0f;
+                    std::string display_name = filename;
+                    ImVec2 name_sz = ImGui::CalcTextSize(display_name.c_str());
+                    if (name_sz.x > max_label_w && display_name.size() > 12) {
+                        std::string ext = file.path.extension().string();
+                        size_t keep = std::max(static_cast<size_t>(6),
+                                               display_name.size() - ext.size());
+                        while (keep > 3) {
+                            display_name = filename.substr(0, keep) + ".." + ext;
+                            name_sz = ImGui::CalcTextSize(display_name.c_str());
+                            if (name_sz.x <= max_label_w) break;
+                            keep--;
+                        }
+                    }
+
+                    // Label background
+                    ImVec2 label_tl(cell_tl.x, cell_br.y - label_h_scaled);
+                    ImVec2 label_br(cell_br.x, cell_br.y);
+                    draw_list->AddRectFilled(label_tl, label_br,
+                        IM_COL32(kLabelBgR, kLabelBgG, kLabelBgB, kLabelBgA));
+
+                    // Label text centered
+                    name_sz = ImGui::CalcTextSize(display_name.c_str());
+                    draw_list->AddText(
+                        ImVec2(cell_tl.x + (cell_w - name_sz.x) * 0.5f,
+                               label_tl.y + (label_h_scaled - name_sz.y) * 0.5f),
+                        IM_COL32(kLabelTextR, kLabelTextG, kLabelTextB, kLabelTextA),
+                        display_name.c_str());
+                }
             }
         }
+        clipper.End();
+
+        // Keep the visible rows (plus a few ahead either way) resident
+        if (first_row < last_row) {
+            const int lo = std::max(0, first_row - kThumbnailLookahead);
+            const int hi = std::min(row_count, last_row + kThumbnailLookahead);
+            m_controller.request_thumbnails(static_cast<size_t>(lo) * kThumbnailCols,
+                                            static_cast<size_t>(hi) * kThumbnailCols);
+        }
     }
 
     ImGui::Spacing();
@@ -235,8 +284,9 @@ void ImagePreview::render_batch_view() {
         float list_height = std::max(100.0f, avail.y * 0.3f);
         ImGui::BeginChild("BatchResults", ImVec2(-1, list_height), true);
 
-        for (size_t i = 0; i < batch.current_index && i < batch.files.size(); ++i) {
-            const auto& f = batch.files[i];
+        // Workers finish out of order: list every file that has started
+        for (const auto& f : batch.files) {
+            if (f.status == BatchFileStatus::Pending) continue;
             std::string filename = f.path.filename().string();
 
             ImVec4 color;
@@ -334,8 +384,8 @@ void ImagePreview::render_image() {
     auto& state = m_controller.state();
     auto& opts = state.preview_options;
 
-    void* tex_id = m_controller.get_preview_texture_id();
-    if (!tex_id) return;
+    TiledTexture& tiles = m_controller.preview_tiles();
+    if (tiles.empty()) return;
 
     // Get available space for the scrolling region
     ImVec2 avail_for_child = ImGui::GetContentRegionAvail();
@@ -469,15 +519,38 @@ void ImagePreview::render_image() {
         child_pos.y + image_y - scroll_y
     );
 
-    // Draw image using DrawList
+    // Draw the visible tiles at the mip level matching the zoom
     ImDrawList* draw_list = ImGui::GetWindowDrawList();
 
-    draw_list->AddImage(
-        reinterpret_cast<ImTextureID>(tex_id),
-        m_image_screen_pos,
-        ImVec2(m_image_screen_pos.x + display_w, m_image_screen_pos.y + display_h),
-        ImVec2(0, 0), ImVec2(1, 1), IM_COL32_WHITE
-    );
+    tiles.draw(draw_list, m_image_screen_pos, m_final_scale,
+               child_pos, ImVec2(child_pos.x + viewport_size.x, child_pos.y + viewport_size.y));
+
+    // Processed pixels: a small patch drawn over the original, so toggling
+    // and split view only change what is drawn (no texture upload)
+    void* overlay_id = m_controller.get_overlay_texture_id();
+    const bool split = opts.split_view && overlay_id;
+    if (overlay_id && (opts.show_processed || split)) {
+        const auto& pr = state.image.processed.rect;
+        const cv::Point2f uv = m_controller.overlay_uv_max();
+        const ImVec2 uv_max(uv.x, uv.y);
+        ImVec2 patch_tl = image_to_screen(static_cast<float>(pr.x), static_cast<float>(pr.y));
+        ImVec2 patch_br = image_to_screen(static_cast<float>(pr.x + pr.width),
+                                          static_cast<float>(pr.y + pr.height));
+
+        if (split) {
+            // Left half of the patch original, right half processed
+            float split_x = (patch_tl.x + patch_br.x) * 0.5f;
+            draw_list->PushClipRect(ImVec2(split_x, patch_tl.y), patch_br, true);
+            draw_list->AddImage(reinterpret_cast<ImTextureID>(overlay_id),
+                                patch_tl, patch_br, ImVec2(0, 0), uv_max, IM_COL32_WHITE);
+            draw_list->PopClipRect();
+            draw_list->AddLine(ImVec2(split_x, patch_tl.y), ImVec2(split_x, patch_br.y),
+                               IM_COL32(255, 255, 255, 200), 1.0f);
+        } else {
+            draw_list->AddImage(reinterpret_cast<ImTextureID>(overlay_id),
+                                patch_tl, patch_br, ImVec2(0, 0), uv_max, IM_COL32_WHITE);
+        }
+    }
 
     // Hold "C" to temporarily hide all region overlays (for clean preview).
     // Use WantTextInput (not WantCaptureKeyboard) — the latter is always true
@@ -488,6 +561,18 @@ void ImagePreview::render_image() {
     bool is_custom_mode = (state.process_options.size_mode == WatermarkSizeMode::Custom);
 
     if (!hide_overlays) {
+        // Confidence heat map: each texel scores the rect placed there, so
+        // it is drawn shifted by half a rect (peaks sit at the rect center)
+        void* heat_id = m_controller.get_confidence_texture_id();
+        if (is_custom_mode && opts.show_confidence_map && heat_id) {
+            const ConfidenceMap& map = m_controller.confidence_map();
+            const float x = map.origin.x + map.logo_size.width * 0.5f;
+            const float y = map.origin.y + map.logo_size.height * 0.5f;
+            draw_list->AddImage(reinterpret_cast<ImTextureID>(heat_id),
+                                image_to_screen(x, y),
+                                image_to_screen(x + map.scores.cols, y + map.scores.rows));
+        }
+
         if (is_custom_mode && state.custom_watermark.has_region) {
             // Custom mode: draw resizable rect with anchors
             draw_custom_rect_with_anchors(draw_list);
@@ -530,7 +615,7 @@ void ImagePreview::render_image() {
     ImGui::SetCursorScreenPos(ImVec2(viewport_start.x + 5, viewport_start.y + 5));
     ImGui::Text("%.0f%% | %s%s",
                 opts.zoom * 100.0f,
-                opts.show_processed ? "Processed" : "Original",
+                split ? "Split" : (opts.show_processed ? "Processed" : "Original"),
                 hide_overlays ? " | [C] Overlay Hidden" : "");
 }
 
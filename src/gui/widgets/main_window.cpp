@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <cstdio>
+#include <string>
 
 namespace gwt::gui {
 
@@ -257,6 +258,7 @@ std::optional<std::filesystem::path> save_file_dialog(const std::string& default
 MainWindow::MainWindow(AppController& controller)
     : m_controller(controller)
     , m_image_preview(std::make_unique<ImagePreview>(controller))
+    , m_perf_overlay(std::make_unique<PerfOverlay>(controller))
 {
     spdlog::debug("MainWindow created");
 }
@@ -268,6 +270,18 @@ MainWindow::~MainWindow() = default;
 // =============================================================================
 
 void MainWindow::render() {
+    m_controller.record_frame_stats();
+
+    // Pick up finished background load/process results and thumbnails
+    m_controller.poll_async_tasks();
+    m_controller.poll_thumbnails();
+    m_controller.poll_batch_scan();
+
+    // Custom rect dragged last frame: rescore its neighborhood (may snap
+    // on release), then refresh just its pixels
+    m_controller.update_confidence_map();
+    m_controller.update_live_preview();
+
     // Update texture if needed
     m_controller.update_texture_if_needed();
 
@@ -330,9 +344,11 @@ void MainWindow::render() {
         render_batch_confirm_dialog();
     }
 
-    // Batch processing tick (process one file per frame)
+    m_perf_overlay->render();
+
+    // Apply results posted by batch workers
     if (m_controller.state().batch.in_progress) {
-        m_controller.process_batch_next();
+        m_controller.poll_batch_progress();
     }
 }
 
@@ -351,7 +367,8 @@ bool MainWindow::handle_event(const SDL_Event& event) {
                 case SDLK_O: action_open_file(); return true;
                 case SDLK_S: action_save_file(); return true;
                 case SDLK_W: action_close_file(); return true;
-                case SDLK_Z: action_revert(); return true;
+                case SDLK_Z: action_undo(); return true;
+                case SDLK_Y: action_redo(); return true;
                 case SDLK_EQUALS: action_zoom_in(); return true;
                 case SDLK_MINUS: action_zoom_out(); return true;
                 case SDLK_0: action_zoom_fit(); return true;
@@ -360,6 +377,7 @@ bool MainWindow::handle_event(const SDL_Event& event) {
         } else if (ctrl && shift) {
             switch (event.key.key) {
                 case SDLK_S: action_save_file_as(); return true;
+                case SDLK_Z: action_redo(); return true;
             }
         } else if (!ctrl && !shift) {
             // Single key shortcuts (no modifiers)
@@ -367,6 +385,10 @@ bool MainWindow::handle_event(const SDL_Event& event) {
                 case SDLK_X: action_process(); return true;
                 case SDLK_V: action_toggle_preview(); return true;
                 case SDLK_Z: action_revert(); return true;
+                case SDLK_H: action_toggle_confidence_map(); return true;
+                case SDLK_PAGEDOWN: action_next_image(); return true;
+                case SDLK_PAGEUP: action_previous_image(); return true;
+                case SDLK_F3: action_toggle_perf_overlay(); return true;
             }
         }
     }
@@ -430,6 +452,13 @@ void MainWindow::render_menu_bar() {
                 action_save_file_as();
             }
             ImGui::Separator();
+            if (ImGui::MenuItem("Next Image", "PgDn", false, m_controller.has_next_image())) {
+                action_next_image();
+            }
+            if (ImGui::MenuItem("Previous Image", "PgUp", false, m_controller.has_previous_image())) {
+                action_previous_image();
+            }
+            ImGui::Separator();
             if (ImGui::MenuItem("Close", "Ctrl+W", false,
                                 m_controller.state().image.has_image() || m_controller.state().batch.is_batch_mode())) {
                 action_close_file();
@@ -445,6 +474,13 @@ void MainWindow::render_menu_bar() {
         }
 
         if (ImGui::BeginMenu("Edit")) {
+            if (ImGui::MenuItem("Undo", "Ctrl+Z", false, m_controller.can_undo())) {
+                action_undo();
+            }
+            if (ImGui::MenuItem("Redo", "Ctrl+Y", false, m_controller.can_redo())) {
+                action_redo();
+            }
+            ImGui::Separator();
             if (ImGui::MenuItem("Process", "X", false, m_controller.state().can_process())) {
                 action_process();
             }
@@ -471,6 +507,14 @@ void MainWindow::render_menu_bar() {
             if (ImGui::MenuItem("100%", "Ctrl+1")) {
                 action_zoom_100();
             }
+            ImGui::Separator();
+            if (ImGui::MenuItem("Confidence Map", "H",
+                                m_controller.state().preview_options.show_confidence_map)) {
+                action_toggle_confidence_map();
+            }
+            if (ImGui::MenuItem("Performance Overlay", "F3", m_controller.state().show_perf_overlay)) {
+                action_toggle_perf_overlay();
+            }
             ImGui::EndMenu();
         }
 
@@ -593,6 +637,8 @@ void MainWindow::render_control_panel() {
                 m_controller.detect_custom_watermark();
             }
 
+            ImGui::Checkbox("Confidence map (H)", &state.preview_options.show_confidence_map);
+
             // Show confidence
             if (state.custom_watermark.detection_confidence > 0.0f) {
                 ImGui::TextColored(
@@ -640,6 +686,7 @@ void MainWindow::render_control_panel() {
         bool use_det = state.batch.use_detection;
         if (ImGui::Checkbox("Auto-detect watermark", &use_det)) {
             state.batch.use_detection = use_det;
+            m_controller.select_batch_by_threshold();
         }
 
         if (state.batch.use_detection) {
@@ -653,6 +700,7 @@ void MainWindow::render_control_panel() {
                 // Snap to 5% steps
                 threshold_pct = ((threshold_pct + 2) / 5) * 5;
                 state.batch.detection_threshold = static_cast<float>(threshold_pct) / 100.0f;
+                m_controller.select_batch_by_threshold();
             }
             if (threshold_pct > 0) {
                 ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f),
@@ -664,6 +712,64 @@ void MainWindow::render_control_panel() {
             ImGui::TextColored(ImVec4(0.4f, 0.6f, 0.4f, 1.0f),
                               "(25%% recommended)");
         }
+
+        // Pre-scan review: click thumbnails to (de)select files
+        const auto& batch = state.batch;
+        ImGui::Spacing();
+        if (batch.scan_in_progress) {
+            ImGui::Text("Scanning: %zu / %zu", batch.scan_done, batch.total());
+        } else {
+            ImGui::Text("Selected: %zu / %zu", batch.selected_count(), batch.total());
+        }
+
+        ImGui::BeginDisabled(batch.in_progress);
+        if (ImGui::Button("Reset Selection", ImVec2(-1, 0))) {
+            m_controller.select_batch_by_threshold();
+        }
+        ImGui::EndDisabled();
+        if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled)) {
+            ImGui::SetTooltip("Select exactly the scanned files that pass the threshold");
+        }
+
+        ImGui::BeginDisabled(!m_controller.can_sort_batch());
+        const float half_w = (ImGui::GetContentRegionAvail().x - ImGui::GetStyle().ItemSpacing.x) * 0.5f;
+        if (ImGui::Button("Sort: Name", ImVec2(half_w, 0))) {
+            m_controller.sort_batch(BatchSortKey::Name);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Sort: Confidence", ImVec2(half_w, 0))) {
+            m_controller.sort_batch(BatchSortKey::Confidence);
+        }
+        ImGui::EndDisabled();
+    }
+
+    // Output encoding
+    ImGui::Spacing();
+    ImGui::Text("Output");
+    ImGui::Separator();
+
+    ImGui::SetNextItemWidth(-1);
+    const std::string current_profile{to_string(opts.encode_profile)};
+    if (ImGui::BeginCombo("##encode_profile", current_profile.c_str())) {
+        for (EncodeProfile profile : kAllEncodeProfiles) {
+            const std::string name{to_string(profile)};
+            const bool selected = (profile == opts.encode_profile);
+            if (ImGui::Selectable(name.c_str(), selected)) {
+                opts.encode_profile = profile;
+            }
+            if (selected) {
+                ImGui::SetItemDefaultFocus();
+            }
+        }
+        ImGui::EndCombo();
+    }
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Encode profile for saved files:\n"
+                          "max: JPEG Q100 / PNG level 6 / lossless WebP\n"
+                          "fast: quickest encode for intermediate files\n"
+                          "balanced: good quality at moderate cost\n"
+                          "smallest: smallest files, slowest encode\n"
+                          "match-input: mirror the source encoding");
     }
 
     // Preview options (only in single-image mode)
@@ -680,8 +786,15 @@ void MainWindow::render_control_panel() {
         bool show_processed = state.preview_options.show_processed;
         ImGui::BeginDisabled(!state.image.has_processed());
         if (ImGui::Checkbox("Show Processed", &show_processed)) {
-            state.preview_options.show_processed = show_processed;
-            m_controller.invalidate_texture();
+            m_controller.toggle_preview();
+        }
+
+        bool split_view = state.preview_options.split_view;
+        if (ImGui::Checkbox("Split View", &split_view)) {
+            state.preview_options.split_view = split_view;
+        }
+        if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled)) {
+            ImGui::SetTooltip("Left half of the watermark area original, right half processed");
         }
         ImGui::EndDisabled();
 
@@ -765,7 +878,10 @@ void MainWindow::render_control_panel() {
         row("X", "Process image");
         row("V", "Compare original");
         row("Z", "Revert to original");
+        row("Ctrl Z / Y", "Undo / redo");
         row("C (hold)", "Hide overlay");
+        row("H", "Confidence map (custom)");
+        row("PgUp/PgDn", "Previous/next image in folder");
         row("W A S D", "Move selected region");
         row("Space", "Pan (hold + drag)");
         row("Alt", "Pan (hold + drag)");
@@ -812,12 +928,23 @@ void MainWindow::render_status_bar() {
     // Status message
     ImGui::Text("%s", state.status_message.c_str());
 
+    // Background load/process progress
+    if (state.is_busy()) {
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(120.0f * scale);
+        ImGui::ProgressBar(state.task_progress, ImVec2(120.0f * scale, ImGui::GetTextLineHeight()), "");
+    }
+
     // Image info on the right
     if (state.image.has_image()) {
         std::string info = fmt::format("{}x{} | {}",
                                         state.image.width,
                                         state.image.height,
                                         state.preview_options.show_processed ? "Processed" : "Original");
+        const auto [index, count] = m_controller.folder_position();
+        if (count > 1) {
+            info = fmt::format("{} / {} | {}", index, count, info);
+        }
 
         float text_width = ImGui::CalcTextSize(info.c_str()).x;
         ImGui::SameLine(ImGui::GetWindowWidth() - text_width - 10.0f * scale);
@@ -867,7 +994,13 @@ void MainWindow::render_batch_confirm_dialog() {
         ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.2f, 1.0f), "Warning: Original files will be overwritten!");
         ImGui::Spacing();
 
-        ImGui::Text("Files to process: %zu", state.batch.total());
+        const size_t selected = state.batch.selected_count();
+        ImGui::Text("Files to process: %zu", selected);
+        if (selected < state.batch.total()) {
+            ImGui::TextColored(ImVec4(0.5f, 0.5f, 0.5f, 1.0f),
+                              "%zu deselected files will be left untouched.",
+                              state.batch.total() - selected);
+        }
         ImGui::Text("Mode: %s", state.process_options.remove_mode ? "Remove Watermark" : "Add Watermark");
 
         // Size mode
@@ -982,10 +1115,36 @@ void MainWindow::action_revert() {
     m_controller.revert_to_original();
 }
 
+void MainWindow::action_undo() {
+    m_controller.undo();
+}
+
+void MainWindow::action_redo() {
+    m_controller.redo();
+}
+
+void MainWindow::action_next_image() {
+    m_controller.next_image();
+}
+
+void MainWindow::action_previous_image() {
+    m_controller.previous_image();
+}
+
 void MainWindow::action_toggle_preview() {
     m_controller.toggle_preview();
 }
 
+void MainWindow::action_toggle_confidence_map() {
+    auto& opts = m_controller.state().preview_options;
+    opts.show_confidence_map = !opts.show_confidence_map;
+}
+
+void MainWindow::action_toggle_perf_overlay() {
+    auto& state = m_controller.state();
+    state.show_perf_overlay = !state.show_perf_overlay;
+}
+
 void MainWindow::action_zoom_in() {
     auto& opts = m_controller.state().preview_options;
     opts.zoom = std::min(opts.zoom * 1.25f, 10.0f);
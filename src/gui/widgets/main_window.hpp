@@ -9,6 +9,7 @@
 
 #include "gui/app/app_controller.hpp"
 #include "gui/widgets/image_preview.hpp"
+#include "gui/widgets/perf_overlay.hpp"
 
 #include <memory>
 #include <string>
@@ -45,6 +46,7 @@ public:
 private:
     AppController& m_controller;
     std::unique_ptr<ImagePreview> m_image_preview;
+    std::unique_ptr<PerfOverlay> m_perf_overlay;
 
     // File dialog state
     std::string m_last_open_path;
@@ -67,9 +69,15 @@ private:
     void action_save_file();
     void action_save_file_as();
     void action_close_file();
+    void action_next_image();
+    void action_previous_image();
     void action_process();
     void action_revert();
+    void action_undo();
+    void action_redo();
     void action_toggle_preview();
+    void action_toggle_confidence_map();
+    void action_toggle_perf_overlay();
     void action_zoom_in();
     void action_zoom_out();
     void action_zoom_fit();
@@ -0,0 +1,144 @@
+/**
+ * @file    perf_overlay.cpp
+ * @brief   Performance Overlay Widget Implementation
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ */
+
+#include "gui/widgets/perf_overlay.hpp"
+
+#include <imgui.h>
+#include <implot.h>
+
+namespace gwt::gui {
+
+namespace {
+
+constexpr float kMinHistorySeconds = 2.0f;
+constexpr float kMaxHistorySeconds = 30.0f;  // ~RollingSeries capacity at 60 fps
+constexpr ImPlotAxisFlags kValueAxisFlags = ImPlotAxisFlags_AutoFit | ImPlotAxisFlags_RangeFit;
+
+void plot_line(const char* label, const RollingSeries& series) {
+    if (series.empty()) return;
+    ImPlot::PlotLine(label, series.xs(), series.ys(), series.size(), 0, series.offset());
+}
+
+void plot_scatter(const char* label, const RollingSeries& series) {
+    if (series.empty()) return;
+    ImPlot::PlotScatter(label, series.xs(), series.ys(), series.size(), 0, series.offset());
+}
+
+void setup_time_axis(float t_min, float t_max) {
+    ImPlot::SetupAxis(ImAxis_X1, nullptr, ImPlotAxisFlags_NoTickLabels);
+    ImPlot::SetupAxisLimits(ImAxis_X1, t_min, t_max, ImGuiCond_Always);
+    ImPlot::SetupLegend(ImPlotLocation_NorthWest, ImPlotLegendFlags_Horizontal);
+}
+
+}  // anonymous namespace
+
+PerfOverlay::PerfOverlay(AppController& controller)
+    : m_controller(controller)
+{
+}
+
+// =============================================================================
+// Render
+// =============================================================================
+
+void PerfOverlay::render() {
+    auto& state = m_controller.state();
+    if (!state.show_perf_overlay) return;
+
+    const float scale = state.dpi_scale;
+    ImGui::SetNextWindowSize(ImVec2(480.0f * scale, 600.0f * scale), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowBgAlpha(0.92f);
+
+    if (!ImGui::Begin("Performance", &state.show_perf_overlay,
+                      ImGuiWindowFlags_NoFocusOnAppearing)) {
+        ImGui::End();
+        return;
+    }
+
+    // Controls
+    if (ImGui::Checkbox("Pause", &m_paused) && m_paused) {
+        m_paused_at = m_controller.perf_time();
+    }
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(140.0f * scale);
+    ImGui::SliderFloat("History", &m_history, kMinHistorySeconds, kMaxHistorySeconds, "%.0f s");
+
+    const float now = m_paused ? m_paused_at : m_controller.perf_time();
+    const float t_min = now - m_history;
+
+    render_summary(t_min);
+    ImGui::Separator();
+    render_frame_plot(t_min, now);
+    render_upload_plot(t_min, now);
+    render_task_plot(t_min, now);
+
+    ImGui::End();
+}
+
+// =============================================================================
+// Sections
+// =============================================================================
+
+void PerfOverlay::render_summary(float since) {
+    const PerfStats& stats = m_controller.perf_stats();
+
+    // Latest value, and the worst one in the visible window
+    ImGui::Text("Frame    %6.2f ms  (max %6.2f)", stats.frame_ms.last(), stats.frame_ms.max_since(since));
+    ImGui::Text("Texture  %6.2f ms  (max %6.2f)", stats.texture_ms.last(), stats.texture_ms.max_since(since));
+    ImGui::Text("Upload   %6.0f KiB (max %6.0f)", stats.upload_kib.last(), stats.upload_kib.max_since(since));
+    ImGui::Text("Queue    %6.0f jobs", stats.queue_depth.last());
+
+    ImGui::Text("Decode %.0f ms   Process %.0f ms   Batch file %.0f ms",
+                stats.decode_ms.last(), stats.process_ms.last(), stats.batch_file_ms.last());
+}
+
+void PerfOverlay::render_frame_plot(float t_min, float t_max) {
+    const PerfStats& stats = m_controller.perf_stats();
+    const float scale = m_controller.state().dpi_scale;
+
+    if (ImPlot::BeginPlot("##FrameTimes", ImVec2(-1, 150.0f * scale))) {
+        setup_time_axis(t_min, t_max);
+        ImPlot::SetupAxis(ImAxis_Y1, "ms", kValueAxisFlags);
+        plot_line("Frame", stats.frame_ms);
+        plot_line("Texture update", stats.texture_ms);
+        ImPlot::EndPlot();
+    }
+}
+
+void PerfOverlay::render_upload_plot(float t_min, float t_max) {
+    const PerfStats& stats = m_controller.perf_stats();
+    const float scale = m_controller.state().dpi_scale;
+
+    if (ImPlot::BeginPlot("##Uploads", ImVec2(-1, 150.0f * scale))) {
+        setup_time_axis(t_min, t_max);
+        ImPlot::SetupAxis(ImAxis_Y1, "KiB", kValueAxisFlags);
+        ImPlot::SetupAxis(ImAxis_Y2, "jobs", kValueAxisFlags | ImPlotAxisFlags_AuxDefault);
+
+        ImPlot::SetAxes(ImAxis_X1, ImAxis_Y1);
+        plot_line("Upload", stats.upload_kib);
+        ImPlot::SetAxes(ImAxis_X1, ImAxis_Y2);
+        plot_line("Queue depth", stats.queue_depth);
+        ImPlot::EndPlot();
+    }
+}
+
+void PerfOverlay::render_task_plot(float t_min, float t_max) {
+    const PerfStats& stats = m_controller.perf_stats();
+    const float scale = m_controller.state().dpi_scale;
+
+    // One point per completed task
+    if (ImPlot::BeginPlot("##Tasks", ImVec2(-1, 150.0f * scale))) {
+        setup_time_axis(t_min, t_max);
+        ImPlot::SetupAxis(ImAxis_Y1, "ms", kValueAxisFlags);
+        plot_scatter("Decode", stats.decode_ms);
+        plot_scatter("Process", stats.process_ms);
+        plot_scatter("Batch file", stats.batch_file_ms);
+        ImPlot::EndPlot();
+    }
+}
+
+}  // namespace gwt::gui
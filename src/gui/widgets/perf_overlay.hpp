@@ -0,0 +1,49 @@
+/**
+ * @file    perf_overlay.hpp
+ * @brief   Performance Overlay Widget
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Floating window (F3, View > Performance Overlay) with rolling ImPlot
+ * charts of AppController::perf_stats(): frame time, texture update time,
+ * upload volume and worker queue depth per frame, and decode / process /
+ * batch-file latencies per task.
+ */
+
+#pragma once
+
+#include "gui/app/app_controller.hpp"
+
+namespace gwt::gui {
+
+class PerfOverlay {
+public:
+    static constexpr float kHistorySeconds = 10.0f;
+
+    explicit PerfOverlay(AppController& controller);
+    ~PerfOverlay() = default;
+
+    // Non-copyable
+    PerfOverlay(const PerfOverlay&) = delete;
+    PerfOverlay& operator=(const PerfOverlay&) = delete;
+
+    /**
+     * Render the overlay if state().show_perf_overlay is set
+     * Call within ImGui context
+     */
+    void render();
+
+private:
+    AppController& m_controller;
+    float m_history{kHistorySeconds};   // Visible time span (s)
+    bool m_paused{false};
+    float m_paused_at{0.0f};
+
+    void render_summary(float since);
+    void render_frame_plot(float t_min, float t_max);
+    void render_upload_plot(float t_min, float t_max);
+    void render_task_plot(float t_min, float t_max);
+};
+
+}  // namespace gwt::gui
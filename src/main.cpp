@@ -10,6 +10,7 @@
  * Launch modes:
  *   - No arguments:           Launch GUI (if available), otherwise show help
  *   - --gui or -g:            Force GUI mode
+ *   - --gui-bench <images>:   Headless GUI benchmark (Null render backend)
  *   - Any other arguments:    CLI mode (original behavior)
  *   - Single file path:       CLI simple mode (in-place edit)
  */
@@ -66,7 +67,7 @@ void setup_console() {
     // Check for explicit --gui flag
     for (int i = 1; i < argc; ++i) {
         std::string_view arg{argv[i]};
-        if (arg == "--gui" || arg == "-g") {
+        if (arg == "--gui" || arg == "-g" || arg == "--gui-bench") {
             return true;
         }
     }
@@ -0,0 +1,130 @@
+/**
+ * @file    mpmc_queue.hpp
+ * @brief   Bounded lock-free multi-producer / multi-consumer queue
+ * @author  AllenK (Kwyshell)
+ * @license MIT
+ *
+ * @details
+ * Dmitry Vyukov's bounded MPMC queue: a power-of-two ring of cells, each
+ * carrying a sequence number that tells producers and consumers whether
+ * the cell is free or filled for the current lap. Push and pop are a
+ * single CAS on the shared position plus one release store; neither side
+ * ever blocks, so a full/empty queue is reported instead of waited on.
+ *
+ * Usage:
+ *   gwt::MpmcQueue<Event> queue(1024);
+ *   queue.try_push(event);          // Worker thread
+ *   while (queue.try_pop(event)) {} // UI thread, once per frame
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace gwt {
+
+template <typename T>
+class MpmcQueue {
+public:
+    /**
+     * @param capacity  Number of slots (rounded up to a power of two, >= 2)
+     */
+    explicit MpmcQueue(size_t capacity)
+        : m_mask(round_up_pow2(capacity) - 1)
+        , m_cells(std::make_unique<Cell[]>(m_mask + 1))
+    {
+        for (size_t i = 0; i <= m_mask; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /**
+     * Enqueue a value
+     * @return false if the queue is full (value is left untouched)
+     */
+    bool try_push(T&& value) {
+        Cell* cell;
+        size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;   // Full
+            } else {
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const T& value) {
+        T copy(value);
+        return try_push(std::move(copy));
+    }
+
+    /**
+     * Dequeue a value
+     * @return false if the queue is empty
+     */
+    bool try_pop(T& out) {
+        Cell* cell;
+        size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;   // Empty
+            } else {
+                pos = m_dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        out = std::move(cell->value);
+        cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept { return m_mask + 1; }
+
+private:
+    // Keep producer and consumer positions on separate cache lines
+    static constexpr size_t kCacheLine = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    static size_t round_up_pow2(size_t n) {
+        size_t p = 2;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    const size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+
+    alignas(kCacheLine) std::atomic<size_t> m_enqueue_pos{0};
+    alignas(kCacheLine) std::atomic<size_t> m_dequeue_pos{0};
+};
+
+}  // namespace gwt